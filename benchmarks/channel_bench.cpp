@@ -0,0 +1,73 @@
+#include "cads/blocking_queue.h"
+#include "cads/channel.h"
+#include "cads/single_thread_executor.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+constexpr int64_t MessageCount = 5'000'000;
+
+cads::DetachedTask producer(cads::Channel<int64_t>& channel)
+{
+    for (int64_t i = 0; i < MessageCount; ++i)
+        co_await channel.push(i);
+    channel.close();
+}
+
+cads::DetachedTask consumer(cads::Channel<int64_t>& channel, int64_t& sink)
+{
+    while (auto value = co_await channel.pop())
+        sink += *value;
+}
+
+// Producer and consumer coroutines on one thread, so the numbers are the pure channel overhead
+void runChannel(const size_t capacity)
+{
+    cads::SingleThreadExecutor executor;
+    cads::Channel<int64_t> channel{executor, capacity};
+    int64_t sink = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    executor.spawn(consumer(channel, sink));
+    executor.spawn(producer(channel));
+    executor.run();
+    const auto stop = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    std::printf("cads::Channel      capacity %5zu: %8.2f Mmsg/s  (sink %lld)\n",
+                capacity, MessageCount / seconds / 1e6, static_cast<long long>(sink));
+}
+
+// Baseline: the same hand-off between two OS threads through a BlockingQueue
+void runBlockingQueue(const size_t capacity)
+{
+    cads::BlockingQueue<int64_t> queue{capacity};
+    int64_t sink = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::thread consumerThread{[&queue, &sink] {
+        while (auto value = queue.pop())
+            sink += *value;
+    }};
+
+    for (int64_t i = 0; i < MessageCount; ++i)
+        queue.push(i);
+    queue.close();
+    consumerThread.join();
+    const auto stop = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    std::printf("cads::BlockingQueue capacity %5zu: %8.2f Mmsg/s  (sink %lld)\n",
+                capacity, MessageCount / seconds / 1e6, static_cast<long long>(sink));
+}
+
+int main()
+{
+    for (const size_t capacity : {0, 1, 64, 1024})
+        runChannel(capacity);
+
+    for (const size_t capacity : {1, 64, 1024})
+        runBlockingQueue(capacity);
+}
@@ -0,0 +1,102 @@
+#include "cads/list.h"
+#include "cads/vector.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <random>
+
+constexpr size_t NodeCount = 2'000'000;
+
+// Links the nodes in random order relative to their addresses, like a long-lived list
+// after a lot of insert/erase churn
+cads::List<int64_t> makeShuffledList()
+{
+    cads::List<int64_t> source;
+    for (size_t i = 0; i < NodeCount; ++i)
+        source.pushBack(static_cast<int64_t>(i));
+
+    cads::Vector<cads::List<int64_t>::Iterator> order;
+    order.reserve(NodeCount);
+    for (auto it = source.begin(); it != source.end(); ++it)
+        order.pushBack(it);
+    std::shuffle(order.begin(), order.end(), std::mt19937_64{42});
+
+    cads::List<int64_t> shuffled;
+    for (const auto& it : order)
+        shuffled.splice(shuffled.end(), source, it, std::next(it));
+    return shuffled;
+}
+
+// Best of a few runs, so one-off costs such as the allocator consolidating freed chunks
+// on its first large request do not land on whichever operation happens to come first
+template<typename Fn>
+void measure(const char* name, Fn&& fn)
+{
+    double best = 0;
+    int64_t result = 0;
+    for (int run = 0; run < 3; ++run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        result = fn();
+        const auto stop = std::chrono::steady_clock::now();
+
+        const double ms = std::chrono::duration<double, std::milli>(stop - start).count();
+        best = run == 0 ? ms : std::min(best, ms);
+    }
+
+    std::printf("  %-24s %9.2f ms  (%lld)\n", name, best, static_cast<long long>(result));
+}
+
+void runAll(cads::List<int64_t>& list)
+{
+    measure("iterator loop sum", [&list] {
+        int64_t sum = 0;
+        for (const int64_t value : list)
+            sum += value;
+        return sum;
+    });
+
+    measure("forEach sum", [&list] {
+        int64_t sum = 0;
+        list.forEach([&sum](const int64_t value) { sum += value; });
+        return sum;
+    });
+
+    measure("remove (no match)", [&list] {
+        list.remove(-1);
+        return static_cast<int64_t>(list.size());
+    });
+
+    measure("reverse", [&list] {
+        list.reverse();
+        return list.front();
+    });
+
+    measure("copy", [&list] {
+        const cads::List<int64_t> copy = list;
+        return copy.back();
+    });
+
+    measure("clear (of a copy)", [&list] {
+        cads::List<int64_t> copy = list;
+        copy.clear();
+        return static_cast<int64_t>(copy.size());
+    });
+}
+
+int main()
+{
+    std::printf("CADS_LIST_PREFETCH_DISTANCE = %zu, %zu nodes\n",
+                cads::List<int64_t>::PrefetchDistance, NodeCount);
+
+    cads::List<int64_t> list = makeShuffledList();
+    std::printf("shuffled allocation:\n");
+    runAll(list);
+
+    list.compact();
+    std::printf("after compact():\n");
+    runAll(list);
+}
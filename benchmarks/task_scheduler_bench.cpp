@@ -0,0 +1,141 @@
+#include "cads/queue.h"
+#include "cads/task_scheduler.h"
+#include "cads/vector.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Baseline: every worker pops from one mutex-protected cads::Queue
+class MutexQueuePool
+{
+public:
+    explicit MutexQueuePool(const size_t threadCount)
+    {
+        for (size_t i = 0; i < threadCount; ++i)
+            m_threads.pushBack(std::thread{[this] { _workerLoop(); }});
+    }
+
+    ~MutexQueuePool()
+    {
+        {
+            std::lock_guard lock{m_mutex};
+            m_stop = true;
+        }
+        m_condition.notify_all();
+
+        for (auto& thread : m_threads)
+            thread.join();
+    }
+
+    void submit(std::function<void()> task)
+    {
+        m_pending.fetch_add(1);
+        {
+            std::lock_guard lock{m_mutex};
+            m_tasks.push(std::move(task));
+        }
+        m_condition.notify_one();
+    }
+
+    void waitIdle()
+    {
+        std::unique_lock lock{m_mutex};
+        m_idle.wait(lock, [this] { return m_pending.load() == 0; });
+    }
+
+private:
+    cads::Vector<std::thread> m_threads;
+    cads::Queue<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::condition_variable m_idle;
+    std::atomic<int64_t> m_pending{0};
+    bool m_stop = false;
+
+    void _workerLoop()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lock{m_mutex};
+                m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+                if (m_tasks.empty())
+                    return;
+
+                task = std::move(m_tasks.front());
+                m_tasks.pop();
+            }
+
+            task();
+
+            if (m_pending.fetch_sub(1) == 1)
+            {
+                std::lock_guard lock{m_mutex};
+                m_idle.notify_all();
+            }
+        }
+    }
+};
+
+template <typename Pool>
+double measureMs(Pool& pool, const std::function<void(Pool&)>& workload)
+{
+    const auto start = std::chrono::steady_clock::now();
+    workload(pool);
+    pool.waitIdle();
+    const auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+// Recursive binary fan-out: every task spawns two children until `depth` reaches zero
+template <typename Pool>
+void fanOut(Pool& pool, std::atomic<int64_t>& sink, const int depth)
+{
+    if (depth == 0)
+    {
+        sink.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    pool.submit([&pool, &sink, depth] { fanOut(pool, sink, depth - 1); });
+    pool.submit([&pool, &sink, depth] { fanOut(pool, sink, depth - 1); });
+}
+
+template <typename Pool>
+void runSuite(const char* name, Pool& pool)
+{
+    std::atomic<int64_t> sink{0};
+
+    const double flat = measureMs<Pool>(pool, [&sink](Pool& p) {
+        for (int i = 0; i < 1'000'000; ++i)
+            p.submit([&sink] { sink.fetch_add(1, std::memory_order_relaxed); });
+    });
+
+    const double nested = measureMs<Pool>(pool, [&sink](Pool& p) {
+        p.submit([&p, &sink] { fanOut(p, sink, 20); });
+    });
+
+    std::printf("%-24s flat 1M tasks: %9.2f ms   fan-out 2^21 tasks: %9.2f ms\n", name, flat, nested);
+}
+
+int main()
+{
+    const size_t threads = std::thread::hardware_concurrency() == 0 ? 4 : std::thread::hardware_concurrency();
+    std::printf("threads: %zu\n", threads);
+
+    {
+        MutexQueuePool pool{threads};
+        runSuite("mutex + cads::Queue", pool);
+    }
+    {
+        cads::TaskScheduler scheduler{threads};
+        runSuite("cads::TaskScheduler", scheduler);
+    }
+}
@@ -0,0 +1,427 @@
+#pragma once
+
+#include "cads/vector.h"
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace cads
+{
+
+// Dynamic bitset packed into 64-bit words. Bits past size() in the last word are kept zero,
+// so counting and comparison work on whole words. Bulk operations are plain loops over
+// contiguous words, which the compiler turns into SIMD code at -O3.
+class BitVector
+{
+public:
+    using size_type = std::size_t;
+    using Word      = std::uint64_t;
+
+    static constexpr size_type WordBits = 64;
+
+    // -- Constructors --
+    BitVector() = default;
+
+    explicit BitVector(const size_type size, const bool value = false)
+    {
+        resize(size, value);
+    }
+
+    // -- Methods --
+    // - Access -
+    bool test(const size_type pos) const
+    {
+        assert(pos < m_size && "BitVector::test: position out of range");
+        return (m_words[pos / WordBits] >> (pos % WordBits)) & 1;
+    }
+
+    bool operator[](const size_type pos) const
+    {
+        return test(pos);
+    }
+
+    bool at(const size_type pos) const
+    {
+        if (pos >= m_size)
+            throw std::out_of_range("BitVector::at: index out of range");
+
+        return test(pos);
+    }
+
+    void set(const size_type pos)
+    {
+        assert(pos < m_size && "BitVector::set: position out of range");
+        m_words[pos / WordBits] |= Word{1} << (pos % WordBits);
+    }
+
+    void set(const size_type pos, const bool value)
+    {
+        assert(pos < m_size && "BitVector::set: position out of range");
+
+        // Branch-free: clear the bit, then or in the new value
+        Word& word = m_words[pos / WordBits];
+        word = (word & ~(Word{1} << (pos % WordBits))) | (Word{value} << (pos % WordBits));
+    }
+
+    void reset(const size_type pos)
+    {
+        assert(pos < m_size && "BitVector::reset: position out of range");
+        m_words[pos / WordBits] &= ~(Word{1} << (pos % WordBits));
+    }
+
+    void flip(const size_type pos)
+    {
+        assert(pos < m_size && "BitVector::flip: position out of range");
+        m_words[pos / WordBits] ^= Word{1} << (pos % WordBits);
+    }
+
+    void setAll() noexcept
+    {
+        for (Word& word : m_words)
+            word = ~Word{0};
+        _clearTail();
+    }
+
+    void resetAll() noexcept
+    {
+        for (Word& word : m_words)
+            word = 0;
+    }
+
+    // Raw storage, wordCount() words; unused high bits of the last word are zero
+    [[nodiscard]] const Word* words() const noexcept
+    {
+        return m_words.data();
+    }
+
+    [[nodiscard]] size_type wordCount() const noexcept
+    {
+        return m_words.size();
+    }
+
+    // - Capacity -
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    void reserve(const size_type bits)
+    {
+        m_words.reserve(_wordsFor(bits));
+    }
+
+    void resize(const size_type newSize, const bool value = false)
+    {
+        if (newSize > m_size && value && m_size % WordBits != 0)
+            m_words.back() |= ~Word{0} << (m_size % WordBits);
+
+        m_words.resize(_wordsFor(newSize), value ? ~Word{0} : Word{0});
+        m_size = newSize;
+        _clearTail();
+    }
+
+    // - Modifiers -
+    void pushBack(const bool value)
+    {
+        if (m_size % WordBits == 0)
+            m_words.pushBack(0);
+
+        m_words.back() |= Word{value} << (m_size % WordBits);
+        ++m_size;
+    }
+
+    void popBack()
+    {
+        assert(!empty() && "BitVector::popBack: vector is empty");
+
+        --m_size;
+        if (m_size % WordBits == 0)
+            m_words.popBack();
+        else
+            m_words.back() &= ~(Word{1} << (m_size % WordBits));
+    }
+
+    void clear() noexcept
+    {
+        m_words.clear();
+        m_size = 0;
+    }
+
+    // - Bulk operations (operands must have the same size) -
+    BitVector& operator&=(const BitVector& other)
+    {
+        assert(m_size == other.m_size && "BitVector: size mismatch");
+
+        Word* dst = m_words.data();
+        const Word* src = other.m_words.data();
+        for (size_type i = 0, n = m_words.size(); i < n; ++i)
+            dst[i] &= src[i];
+        return *this;
+    }
+
+    BitVector& operator|=(const BitVector& other)
+    {
+        assert(m_size == other.m_size && "BitVector: size mismatch");
+
+        Word* dst = m_words.data();
+        const Word* src = other.m_words.data();
+        for (size_type i = 0, n = m_words.size(); i < n; ++i)
+            dst[i] |= src[i];
+        return *this;
+    }
+
+    BitVector& operator^=(const BitVector& other)
+    {
+        assert(m_size == other.m_size && "BitVector: size mismatch");
+
+        Word* dst = m_words.data();
+        const Word* src = other.m_words.data();
+        for (size_type i = 0, n = m_words.size(); i < n; ++i)
+            dst[i] ^= src[i];
+        return *this;
+    }
+
+    // this &= ~other, without materialising ~other
+    BitVector& andNot(const BitVector& other)
+    {
+        assert(m_size == other.m_size && "BitVector: size mismatch");
+
+        Word* dst = m_words.data();
+        const Word* src = other.m_words.data();
+        for (size_type i = 0, n = m_words.size(); i < n; ++i)
+            dst[i] &= ~src[i];
+        return *this;
+    }
+
+    void flipAll() noexcept
+    {
+        for (Word& word : m_words)
+            word = ~word;
+        _clearTail();
+    }
+
+    // - Queries -
+    [[nodiscard]] size_type count() const noexcept
+    {
+        size_type total = 0;
+        for (const Word word : m_words)
+            total += std::popcount(word);
+        return total;
+    }
+
+    [[nodiscard]] bool any() const noexcept
+    {
+        for (const Word word : m_words)
+            if (word != 0)
+                return true;
+        return false;
+    }
+
+    [[nodiscard]] bool none() const noexcept
+    {
+        return !any();
+    }
+
+    [[nodiscard]] bool all() const noexcept
+    {
+        return count() == m_size;
+    }
+
+    // First set bit at or after `pos`, or size() if there is none
+    [[nodiscard]] size_type findNext(const size_type pos) const noexcept
+    {
+        if (pos >= m_size)
+            return m_size;
+
+        size_type index = pos / WordBits;
+        Word word = m_words[index] & (~Word{0} << (pos % WordBits));
+
+        while (word == 0)
+        {
+            if (++index == m_words.size())
+                return m_size;
+            word = m_words[index];
+        }
+
+        return index * WordBits + std::countr_zero(word);
+    }
+
+    [[nodiscard]] size_type findFirst() const noexcept
+    {
+        return findNext(0);
+    }
+
+    // Calls `fn(position)` for every set bit in increasing order; one ctz per set bit
+    template<typename Fn>
+    void forEachSetBit(Fn&& fn) const
+    {
+        for (size_type index = 0, n = m_words.size(); index < n; ++index)
+        {
+            for (Word word = m_words[index]; word != 0; word &= word - 1)
+                fn(index * WordBits + std::countr_zero(word));
+        }
+    }
+
+    bool operator==(const BitVector& other) const noexcept
+    {
+        if (m_size != other.m_size)
+            return false;
+
+        for (size_type i = 0, n = m_words.size(); i < n; ++i)
+            if (m_words[i] != other.m_words[i])
+                return false;
+        return true;
+    }
+
+    void swap(BitVector& other) noexcept
+    {
+        m_words.swap(other.m_words);
+        std::swap(m_size, other.m_size);
+    }
+
+private:
+    Vector<Word> m_words;
+    size_type m_size = 0;
+
+    static constexpr size_type _wordsFor(const size_type bits) noexcept
+    {
+        return (bits + WordBits - 1) / WordBits;
+    }
+
+    void _clearTail() noexcept
+    {
+        if (m_size % WordBits != 0)
+            m_words.back() &= (Word{1} << (m_size % WordBits)) - 1;
+    }
+};
+
+inline BitVector operator&(BitVector lhs, const BitVector& rhs) { return lhs &= rhs; }
+inline BitVector operator|(BitVector lhs, const BitVector& rhs) { return lhs |= rhs; }
+inline BitVector operator^(BitVector lhs, const BitVector& rhs) { return lhs ^= rhs; }
+
+
+// Succinct rank/select directory over a BitVector: one 64-bit running count per 512-bit
+// block, about 12.5% extra space. rank1() costs at most eight popcounts; select1() is a
+// binary search over blocks plus a short word scan.
+// Refers to the bits of the BitVector it was built from; rebuild after modifying it.
+class RankSelectIndex
+{
+public:
+    using size_type = std::size_t;
+
+    static constexpr size_type WordsPerBlock = 8;
+
+    RankSelectIndex() = default;
+
+    explicit RankSelectIndex(const BitVector& bits)
+    {
+        rebuild(bits);
+    }
+
+    void rebuild(const BitVector& bits)
+    {
+        m_bits = &bits;
+        m_blockRanks.clear();
+
+        const size_type wordCount = bits.wordCount();
+        m_blockRanks.reserve(wordCount / WordsPerBlock + 2);
+
+        size_type total = 0;
+        for (size_type word = 0; word < wordCount; ++word)
+        {
+            if (word % WordsPerBlock == 0)
+                m_blockRanks.pushBack(total);
+            total += std::popcount(bits.words()[word]);
+        }
+        m_blockRanks.pushBack(total);
+        m_ones = total;
+    }
+
+    // Number of set bits in [0, pos)
+    [[nodiscard]] size_type rank1(const size_type pos) const noexcept
+    {
+        assert(m_bits != nullptr && pos <= m_bits->size() && "RankSelectIndex::rank1: position out of range");
+
+        const BitVector::Word* words = m_bits->words();
+        const size_type wordIndex = pos / BitVector::WordBits;
+
+        size_type rank = m_blockRanks[wordIndex / WordsPerBlock];
+        for (size_type word = wordIndex - wordIndex % WordsPerBlock; word < wordIndex; ++word)
+            rank += std::popcount(words[word]);
+
+        if (const size_type bit = pos % BitVector::WordBits; bit != 0)
+            rank += std::popcount(words[wordIndex] & ((BitVector::Word{1} << bit) - 1));
+
+        return rank;
+    }
+
+    [[nodiscard]] size_type rank0(const size_type pos) const noexcept
+    {
+        return pos - rank1(pos);
+    }
+
+    // Position of the k-th set bit (0-based); size() of the BitVector if k >= count
+    [[nodiscard]] size_type select1(size_type k) const noexcept
+    {
+        assert(m_bits != nullptr && "RankSelectIndex::select1: index not built");
+        if (k >= m_ones)
+            return m_bits->size();
+
+        // Last block whose running count is <= k
+        size_type low = 0;
+        size_type high = m_blockRanks.size() - 1;
+        while (high - low > 1)
+        {
+            const size_type mid = low + (high - low) / 2;
+            if (m_blockRanks[mid] <= k)
+                low = mid;
+            else
+                high = mid;
+        }
+
+        k -= m_blockRanks[low];
+        const BitVector::Word* words = m_bits->words();
+        for (size_type word = low * WordsPerBlock;; ++word)
+        {
+            const size_type ones = std::popcount(words[word]);
+            if (k < ones)
+                return word * BitVector::WordBits + _selectInWord(words[word], k);
+            k -= ones;
+        }
+    }
+
+    [[nodiscard]] size_type count() const noexcept
+    {
+        return m_ones;
+    }
+
+private:
+    const BitVector* m_bits = nullptr;
+    Vector<size_type> m_blockRanks; // Set bits before each block, plus the total at the end
+    size_type m_ones = 0;
+
+    static size_type _selectInWord(BitVector::Word word, size_type k) noexcept
+    {
+#if defined(__BMI2__)
+        return std::countr_zero(_pdep_u64(BitVector::Word{1} << k, word));
+#else
+        for (; k > 0; --k)
+            word &= word - 1;
+        return std::countr_zero(word);
+#endif
+    }
+};
+
+} // namespace cads
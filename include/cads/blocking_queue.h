@@ -0,0 +1,211 @@
+#pragma once
+
+#include "cads/list.h"
+#include "cads/queue.h"
+#include "cads/vector.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace cads
+{
+
+// Thread-safe FIFO on top of the `Queue` adaptor. A non-zero capacity makes producers
+// block while the queue is full (backpressure). After close(), pushes fail and pops
+// drain what is left, then report the queue as finished.
+template <typename ValType, typename Container = List<ValType>>
+class BlockingQueue
+{
+public:
+    using value_type      = ValType;
+    using size_type       = std::size_t;
+    using reference       = ValType&;
+    using const_reference = const ValType&;
+
+    static constexpr size_type Unbounded = 0;
+
+    explicit BlockingQueue(const size_type capacity = Unbounded)
+        : m_capacity(capacity)
+    { }
+
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+
+    [[nodiscard]] size_type size() const
+    {
+        std::lock_guard lock{m_mutex};
+        return m_queue.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        std::lock_guard lock{m_mutex};
+        return m_queue.empty();
+    }
+
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+
+    // - Producers -
+    // Blocks while full; false if the queue is closed
+    bool push(const ValType& val)
+    {
+        return _push(val, [this](std::unique_lock<std::mutex>& lock) {
+            m_notFull.wait(lock, [this] { return !_full(); });
+            return true;
+        });
+    }
+
+    bool push(ValType&& val)
+    {
+        return _push(std::move(val), [this](std::unique_lock<std::mutex>& lock) {
+            m_notFull.wait(lock, [this] { return !_full(); });
+            return true;
+        });
+    }
+
+    // Never blocks; false if full or closed
+    bool tryPush(const ValType& val)
+    {
+        return _push(val, [](std::unique_lock<std::mutex>&) { return false; });
+    }
+
+    bool tryPush(ValType&& val)
+    {
+        return _push(std::move(val), [](std::unique_lock<std::mutex>&) { return false; });
+    }
+
+    // Blocks at most `timeout` for room; false on timeout or if closed
+    template <typename Rep, typename Period>
+    bool pushFor(ValType val, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        return _push(std::move(val), [this, &timeout](std::unique_lock<std::mutex>& lock) {
+            return m_notFull.wait_for(lock, timeout, [this] { return !_full(); });
+        });
+    }
+
+
+    // - Consumers -
+    // Blocks while empty; nullopt once the queue is closed and drained
+    std::optional<ValType> pop()
+    {
+        std::unique_lock lock{m_mutex};
+        m_notEmpty.wait(lock, [this] { return !m_queue.empty() || m_closed; });
+
+        return _popLocked(lock);
+    }
+
+    std::optional<ValType> tryPop()
+    {
+        std::unique_lock lock{m_mutex};
+        return _popLocked(lock);
+    }
+
+    template <typename Rep, typename Period>
+    std::optional<ValType> popFor(const std::chrono::duration<Rep, Period>& timeout)
+    {
+        std::unique_lock lock{m_mutex};
+        m_notEmpty.wait_for(lock, timeout, [this] { return !m_queue.empty() || m_closed; });
+
+        return _popLocked(lock);
+    }
+
+    // Moves up to `maxCount` elements into `out` under a single lock acquisition, without
+    // waiting. Returns the number moved.
+    size_type drainTo(Vector<ValType>& out, const size_type maxCount)
+    {
+        size_type moved = 0;
+        {
+            std::lock_guard lock{m_mutex};
+
+            out.reserve(out.size() + (maxCount < m_queue.size() ? maxCount : m_queue.size()));
+            while (moved < maxCount && !m_queue.empty())
+            {
+                out.pushBack(std::move(m_queue.front()));
+                m_queue.pop();
+                ++moved;
+            }
+        }
+
+        if (moved > 0 && m_capacity != Unbounded)
+            m_notFull.notify_all();
+
+        return moved;
+    }
+
+
+    // Wakes every waiter; later pushes fail, pops drain the remaining elements
+    void close()
+    {
+        {
+            std::lock_guard lock{m_mutex};
+            m_closed = true;
+        }
+        m_notEmpty.notify_all();
+        m_notFull.notify_all();
+    }
+
+    [[nodiscard]] bool isClosed() const
+    {
+        std::lock_guard lock{m_mutex};
+        return m_closed;
+    }
+
+private:
+    Queue<ValType, Container> m_queue;
+    const size_type m_capacity;
+    bool m_closed = false;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_notEmpty;
+    std::condition_variable m_notFull;
+
+    // Only meaningful under the lock; a closed queue counts as "not full" so waiters wake up
+    bool _full() const
+    {
+        return !m_closed && m_capacity != Unbounded && m_queue.size() >= m_capacity;
+    }
+
+    // `waitForRoom(lock)` is called only when the queue is full and returns whether room appeared
+    template <typename Value, typename WaitForRoom>
+    bool _push(Value&& val, WaitForRoom&& waitForRoom)
+    {
+        {
+            std::unique_lock lock{m_mutex};
+
+            if (_full() && !waitForRoom(lock))
+                return false;
+            if (m_closed)
+                return false;
+
+            m_queue.push(std::forward<Value>(val));
+        }
+        m_notEmpty.notify_one();
+        return true;
+    }
+
+    std::optional<ValType> _popLocked(std::unique_lock<std::mutex>& lock)
+    {
+        if (m_queue.empty())
+            return std::nullopt;
+
+        std::optional<ValType> result{std::move(m_queue.front())};
+        m_queue.pop();
+
+        lock.unlock();
+        if (m_capacity != Unbounded)
+            m_notFull.notify_one();
+
+        return result;
+    }
+};
+
+} // namespace cads
@@ -0,0 +1,309 @@
+#pragma once
+
+#include "cads/vector.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+
+namespace cads
+{
+
+template<typename KeyType, typename ValType, size_t NodeBytes = 256>
+class BTreeMap // Ordered map on a B+-tree with cache-line sized nodes
+{
+private:
+    // Declaration
+    struct Node;
+    struct LeafNode;
+    struct InnerNode;
+
+    static_assert(NodeBytes >= 64, "BTreeMap nodes should span at least one cache line");
+
+    static constexpr size_t LeafHeaderBytes = sizeof(size_t) + 2 * sizeof(void*);
+    static constexpr size_t InnerHeaderBytes = sizeof(size_t) + sizeof(void*);
+
+public:
+    // Entries per leaf / separator keys per inner node that fit into `NodeBytes`
+    static constexpr size_t LeafCapacity =
+        std::max<size_t>(3, (NodeBytes - LeafHeaderBytes) / (sizeof(KeyType) + sizeof(ValType)));
+    static constexpr size_t InnerCapacity =
+        std::max<size_t>(3, (NodeBytes - InnerHeaderBytes) / (sizeof(KeyType) + sizeof(void*)));
+
+    class Iterator;
+    class ConstIterator;
+
+    using key_type        = KeyType;
+    using mapped_type     = ValType;
+    using size_type       = std::size_t;
+    using iterator        = Iterator;
+    using const_iterator  = ConstIterator;
+
+    // `it->first` / `it->second` support for iterators that yield pairs of references
+    template<typename Ref>
+    struct ArrowProxy
+    {
+        Ref ref;
+        Ref* operator->() noexcept { return &ref; }
+    };
+
+    // -- Iterators --
+    // Keys and values live in separate arrays, so iterators yield pairs of references
+    class Iterator
+    {
+    public:
+        // For integration with STL algorithms
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = std::pair<const KeyType, ValType>;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = std::pair<const KeyType&, ValType&>;
+        using pointer           = ArrowProxy<reference>;
+
+        friend class ConstIterator;
+        friend class BTreeMap;
+
+        explicit Iterator(LeafNode* leaf = nullptr, size_t index = 0) : m_leaf(leaf), m_index(index) {}
+
+        Iterator(const Iterator&) = default;
+        Iterator(Iterator&&) noexcept = default;
+        Iterator& operator=(const Iterator&) = default;
+        Iterator& operator=(Iterator&&) noexcept = default;
+
+        ~Iterator() = default;
+
+        const KeyType& key() const { return m_leaf->keys()[m_index]; }
+        ValType& value() const { return m_leaf->values()[m_index]; }
+
+        reference operator*() const { return {key(), value()}; }
+        pointer operator->() const { return pointer{**this}; }
+
+        Iterator& operator++() { _increment(); return *this; }
+        Iterator operator++(int) { auto temp = *this; _increment(); return temp; }
+        Iterator& operator--() { _decrement(); return *this; }
+        Iterator operator--(int) { auto temp = *this; _decrement(); return temp; }
+
+        bool operator==(const Iterator& other) const = default;
+
+    private:
+        LeafNode* m_leaf;
+        size_t m_index;
+
+        void _increment()
+        {
+            if (++m_index == m_leaf->count && m_leaf->next != nullptr)
+            {
+                m_leaf = m_leaf->next;
+                m_index = 0;
+            }
+        }
+
+        void _decrement()
+        {
+            if (m_index == 0)
+            {
+                m_leaf = m_leaf->prev;
+                m_index = m_leaf->count;
+            }
+            --m_index;
+        }
+    };
+
+    class ConstIterator
+    {
+    public:
+        // For integration with STL algorithms
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = std::pair<const KeyType, ValType>;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = std::pair<const KeyType&, const ValType&>;
+        using pointer           = ArrowProxy<reference>;
+
+        friend class BTreeMap;
+
+        explicit ConstIterator(const LeafNode* leaf = nullptr, size_t index = 0) : m_leaf(leaf), m_index(index) {}
+
+        ConstIterator(const ConstIterator&) = default;
+        ConstIterator(ConstIterator&&) noexcept = default;
+        ConstIterator& operator=(const ConstIterator&) = default;
+        ConstIterator& operator=(ConstIterator&&) noexcept = default;
+
+        ConstIterator(const Iterator& it) : m_leaf(it.m_leaf), m_index(it.m_index) {}
+
+        ~ConstIterator() = default;
+
+        const KeyType& key() const { return m_leaf->keys()[m_index]; }
+        const ValType& value() const { return m_leaf->values()[m_index]; }
+
+        reference operator*() const { return {key(), value()}; }
+        pointer operator->() const { return pointer{**this}; }
+
+        ConstIterator& operator++() { _increment(); return *this; }
+        ConstIterator operator++(int) { auto temp = *this; _increment(); return temp; }
+        ConstIterator& operator--() { _decrement(); return *this; }
+        ConstIterator operator--(int) { auto temp = *this; _decrement(); return temp; }
+
+        bool operator==(const ConstIterator& other) const = default;
+
+    private:
+        const LeafNode* m_leaf;
+        size_t m_index;
+
+        void _increment()
+        {
+            if (++m_index == m_leaf->count && m_leaf->next != nullptr)
+            {
+                m_leaf = m_leaf->next;
+                m_index = 0;
+            }
+        }
+
+        void _decrement()
+        {
+            if (m_index == 0)
+            {
+                m_leaf = m_leaf->prev;
+                m_index = m_leaf->count;
+            }
+            --m_index;
+        }
+    };
+
+    using ReverseIterator = std::reverse_iterator<Iterator>;
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+    // -- Constructors --
+    BTreeMap();
+    BTreeMap(const BTreeMap& other);
+    BTreeMap(BTreeMap&& other) noexcept;
+    BTreeMap& operator=(const BTreeMap& other);
+    BTreeMap& operator=(BTreeMap&& other) noexcept;
+
+    // -- Destructor --
+    ~BTreeMap();
+
+    // -- Methods --
+    // - Access -
+    ValType& at(const KeyType& key);
+    const ValType& at(const KeyType& key) const;
+    ValType& operator[](const KeyType& key);
+
+    // - Lookup -
+    Iterator find(const KeyType& key);
+    ConstIterator find(const KeyType& key) const;
+    [[nodiscard]] bool contains(const KeyType& key) const;
+
+    Iterator lowerBound(const KeyType& key);             // First entry with key >= `key`
+    ConstIterator lowerBound(const KeyType& key) const;
+    Iterator upperBound(const KeyType& key);             // First entry with key > `key`
+    ConstIterator upperBound(const KeyType& key) const;
+
+    // - Iterator methods -
+    Iterator begin() noexcept;
+    ConstIterator begin() const noexcept;
+    Iterator end() noexcept;
+    ConstIterator end() const noexcept;
+
+    ConstIterator cbegin() const noexcept;
+    ConstIterator cend() const noexcept;
+
+    ReverseIterator rbegin() noexcept;
+    ConstReverseIterator rbegin() const noexcept;
+    ReverseIterator rend() noexcept;
+    ConstReverseIterator rend() const noexcept;
+
+    // - Size -
+    [[nodiscard]] size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+    // - Modifiers -
+    // Any modification invalidates all iterators
+    std::pair<Iterator, bool> insert(const KeyType& key, const ValType& value);
+    std::pair<Iterator, bool> insert(KeyType&& key, ValType&& value);
+    std::pair<Iterator, bool> insertOrAssign(const KeyType& key, const ValType& value);
+
+    size_t erase(const KeyType& key);
+    Iterator erase(ConstIterator pos);
+    void clear() noexcept;
+
+    void swap(BTreeMap& other) noexcept;
+
+    // Replaces the content; `sorted` must be ordered by strictly increasing keys
+    void bulkLoad(const Vector<std::pair<KeyType, ValType>>& sorted);
+
+private:
+    struct Node
+    {
+        size_t count; // Entries in a leaf, separator keys in an inner node
+    };
+
+    struct LeafNode : Node
+    {
+        LeafNode* prev = nullptr;
+        LeafNode* next = nullptr;
+        alignas(KeyType) unsigned char keyStorage[sizeof(KeyType) * LeafCapacity];
+        alignas(ValType) unsigned char valueStorage[sizeof(ValType) * LeafCapacity];
+
+        LeafNode() : Node{0} {}
+
+        KeyType* keys() noexcept { return std::launder(reinterpret_cast<KeyType*>(keyStorage)); }
+        const KeyType* keys() const noexcept { return std::launder(reinterpret_cast<const KeyType*>(keyStorage)); }
+        ValType* values() noexcept { return std::launder(reinterpret_cast<ValType*>(valueStorage)); }
+        const ValType* values() const noexcept { return std::launder(reinterpret_cast<const ValType*>(valueStorage)); }
+    };
+
+    struct InnerNode : Node
+    {
+        // children[i] holds keys in [keys[i - 1], keys[i])
+        alignas(KeyType) unsigned char keyStorage[sizeof(KeyType) * InnerCapacity];
+        Node* children[InnerCapacity + 1];
+
+        InnerNode() : Node{0} {}
+
+        KeyType* keys() noexcept { return std::launder(reinterpret_cast<KeyType*>(keyStorage)); }
+        const KeyType* keys() const noexcept { return std::launder(reinterpret_cast<const KeyType*>(keyStorage)); }
+    };
+
+    // Every inner node has at least two children, so this bounds any reachable height
+    static constexpr size_t MaxHeight = 64;
+    static constexpr size_t MinLeafCount = LeafCapacity / 2;
+    static constexpr size_t MinInnerCount = InnerCapacity / 2;
+
+    Node* m_root;
+    LeafNode* m_head;
+    LeafNode* m_tail;
+    size_t m_size;
+    size_t m_height; // Inner levels above the leaves
+
+    template<typename K, typename V>
+    std::pair<Iterator, bool> _insert(K&& key, V&& value, bool assign);
+    void _insertIntoParent(InnerNode** path, const size_t* pathIndex, size_t level, KeyType separator, Node* rightChild);
+
+    void _rebalanceLeaf(LeafNode* leaf, InnerNode** path, const size_t* pathIndex);
+    void _rebalanceInner(InnerNode** path, const size_t* pathIndex, size_t level);
+
+    template<typename Construct>
+    void _buildSorted(size_t count, Construct&& construct);
+    void _discardBuild(const Vector<InnerNode*>& inners) noexcept;
+    static void _constructEntry(KeyType* key, ValType* value, const KeyType& sourceKey, const ValType& sourceValue);
+
+    LeafNode* _findLeaf(const KeyType& key) const;
+    Iterator _makeIterator(LeafNode* leaf, size_t index) const;
+    void _destroy(Node* node, size_t level) noexcept;
+
+    static size_t _lowerIndex(const KeyType* keys, size_t count, const KeyType& key);
+    static size_t _upperIndex(const KeyType* keys, size_t count, const KeyType& key);
+
+    // Operations on arrays whose first `count` slots hold live objects
+    template<typename T>
+    static void _insertAt(T* items, size_t count, size_t pos, T&& value);
+    template<typename T>
+    static void _eraseAt(T* items, size_t count, size_t pos);
+    template<typename T>
+    static void _moveAppend(T* source, size_t first, size_t last, T* destination, size_t destinationCount);
+};
+
+} // namespace cads
+
+#include "cads/btree_map.tpp"
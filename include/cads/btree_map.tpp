@@ -0,0 +1,924 @@
+#pragma once
+
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+
+// -- Constructors --
+template <typename KeyType, typename ValType, size_t NodeBytes>
+cads::BTreeMap<KeyType, ValType, NodeBytes>::BTreeMap()
+    : m_root{nullptr}
+    , m_head{nullptr}
+    , m_tail{nullptr}
+    , m_size{0}
+    , m_height{0}
+{ }
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+cads::BTreeMap<KeyType, ValType, NodeBytes>::BTreeMap(const BTreeMap& other)
+    : BTreeMap()
+{
+    ConstIterator source = other.begin();
+    _buildSorted(other.m_size, [&source](KeyType* key, ValType* value) {
+        _constructEntry(key, value, source.key(), source.value());
+        ++source;
+    });
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+cads::BTreeMap<KeyType, ValType, NodeBytes>::BTreeMap(BTreeMap&& other) noexcept
+    : m_root{other.m_root}
+    , m_head{other.m_head}
+    , m_tail{other.m_tail}
+    , m_size{other.m_size}
+    , m_height{other.m_height}
+{
+    other.m_root = nullptr;
+    other.m_head = nullptr;
+    other.m_tail = nullptr;
+    other.m_size = 0;
+    other.m_height = 0;
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+cads::BTreeMap<KeyType, ValType, NodeBytes>& cads::BTreeMap<KeyType, ValType, NodeBytes>::operator=(const BTreeMap& other)
+{
+    if (this != &other)
+    {
+        BTreeMap temp{other};
+        swap(temp);
+    }
+    return *this;
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+cads::BTreeMap<KeyType, ValType, NodeBytes>& cads::BTreeMap<KeyType, ValType, NodeBytes>::operator=(BTreeMap&& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        swap(other);
+    }
+    return *this;
+}
+
+// -- Destructor --
+template <typename KeyType, typename ValType, size_t NodeBytes>
+cads::BTreeMap<KeyType, ValType, NodeBytes>::~BTreeMap()
+{
+    clear();
+}
+
+// -- Methods --
+// - Access -
+template <typename KeyType, typename ValType, size_t NodeBytes>
+ValType& cads::BTreeMap<KeyType, ValType, NodeBytes>::at(const KeyType& key)
+{
+    Iterator it = find(key);
+    if (it == end())
+        throw std::out_of_range("BTreeMap::at: key not found");
+
+    return it.value();
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+const ValType& cads::BTreeMap<KeyType, ValType, NodeBytes>::at(const KeyType& key) const
+{
+    ConstIterator it = find(key);
+    if (it == end())
+        throw std::out_of_range("BTreeMap::at: key not found");
+
+    return it.value();
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+ValType& cads::BTreeMap<KeyType, ValType, NodeBytes>::operator[](const KeyType& key)
+{
+    return _insert(key, ValType{}, false).first.value();
+}
+
+// - Lookup -
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::Iterator cads::BTreeMap<KeyType, ValType, NodeBytes>::find(const KeyType& key)
+{
+    Iterator it = lowerBound(key);
+    if (it == end() || key < it.key())
+        return end();
+
+    return it;
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::ConstIterator cads::BTreeMap<KeyType, ValType, NodeBytes>::find(const KeyType& key) const
+{
+    ConstIterator it = lowerBound(key);
+    if (it == end() || key < it.key())
+        return end();
+
+    return it;
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+bool cads::BTreeMap<KeyType, ValType, NodeBytes>::contains(const KeyType& key) const
+{
+    return find(key) != end();
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::Iterator cads::BTreeMap<KeyType, ValType, NodeBytes>::lowerBound(const KeyType& key)
+{
+    if (m_root == nullptr)
+        return end();
+
+    LeafNode* leaf = _findLeaf(key);
+    return _makeIterator(leaf, _lowerIndex(leaf->keys(), leaf->count, key));
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::ConstIterator cads::BTreeMap<KeyType, ValType, NodeBytes>::lowerBound(const KeyType& key) const
+{
+    if (m_root == nullptr)
+        return end();
+
+    LeafNode* leaf = _findLeaf(key);
+    return _makeIterator(leaf, _lowerIndex(leaf->keys(), leaf->count, key));
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::Iterator cads::BTreeMap<KeyType, ValType, NodeBytes>::upperBound(const KeyType& key)
+{
+    if (m_root == nullptr)
+        return end();
+
+    LeafNode* leaf = _findLeaf(key);
+    return _makeIterator(leaf, _upperIndex(leaf->keys(), leaf->count, key));
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::ConstIterator cads::BTreeMap<KeyType, ValType, NodeBytes>::upperBound(const KeyType& key) const
+{
+    if (m_root == nullptr)
+        return end();
+
+    LeafNode* leaf = _findLeaf(key);
+    return _makeIterator(leaf, _upperIndex(leaf->keys(), leaf->count, key));
+}
+
+// - Iterator methods -
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::Iterator cads::BTreeMap<KeyType, ValType, NodeBytes>::begin() noexcept
+{
+    return Iterator{m_head, 0};
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::ConstIterator cads::BTreeMap<KeyType, ValType, NodeBytes>::begin() const noexcept
+{
+    return ConstIterator{m_head, 0};
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::Iterator cads::BTreeMap<KeyType, ValType, NodeBytes>::end() noexcept
+{
+    return Iterator{m_tail, m_tail != nullptr ? m_tail->count : 0};
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::ConstIterator cads::BTreeMap<KeyType, ValType, NodeBytes>::end() const noexcept
+{
+    return ConstIterator{m_tail, m_tail != nullptr ? m_tail->count : 0};
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::ConstIterator cads::BTreeMap<KeyType, ValType, NodeBytes>::cbegin() const noexcept
+{
+    return begin();
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::ConstIterator cads::BTreeMap<KeyType, ValType, NodeBytes>::cend() const noexcept
+{
+    return end();
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::ReverseIterator cads::BTreeMap<KeyType, ValType, NodeBytes>::rbegin() noexcept
+{
+    return ReverseIterator{end()};
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::ConstReverseIterator cads::BTreeMap<KeyType, ValType, NodeBytes>::rbegin() const noexcept
+{
+    return ConstReverseIterator{end()};
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::ReverseIterator cads::BTreeMap<KeyType, ValType, NodeBytes>::rend() noexcept
+{
+    return ReverseIterator{begin()};
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::ConstReverseIterator cads::BTreeMap<KeyType, ValType, NodeBytes>::rend() const noexcept
+{
+    return ConstReverseIterator{begin()};
+}
+
+// - Size -
+template <typename KeyType, typename ValType, size_t NodeBytes>
+size_t cads::BTreeMap<KeyType, ValType, NodeBytes>::size() const noexcept
+{
+    return m_size;
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+bool cads::BTreeMap<KeyType, ValType, NodeBytes>::empty() const noexcept
+{
+    return m_size == 0;
+}
+
+// - Modifiers -
+template <typename KeyType, typename ValType, size_t NodeBytes>
+std::pair<typename cads::BTreeMap<KeyType, ValType, NodeBytes>::Iterator, bool>
+cads::BTreeMap<KeyType, ValType, NodeBytes>::insert(const KeyType& key, const ValType& value)
+{
+    return _insert(key, value, false);
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+std::pair<typename cads::BTreeMap<KeyType, ValType, NodeBytes>::Iterator, bool>
+cads::BTreeMap<KeyType, ValType, NodeBytes>::insert(KeyType&& key, ValType&& value)
+{
+    return _insert(std::move(key), std::move(value), false);
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+std::pair<typename cads::BTreeMap<KeyType, ValType, NodeBytes>::Iterator, bool>
+cads::BTreeMap<KeyType, ValType, NodeBytes>::insertOrAssign(const KeyType& key, const ValType& value)
+{
+    return _insert(key, value, true);
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+size_t cads::BTreeMap<KeyType, ValType, NodeBytes>::erase(const KeyType& key)
+{
+    if (m_root == nullptr)
+        return 0;
+
+    InnerNode* path[MaxHeight];
+    size_t pathIndex[MaxHeight];
+
+    Node* node = m_root;
+    for (size_t level = 0; level < m_height; ++level)
+    {
+        auto* inner = static_cast<InnerNode*>(node);
+        pathIndex[level] = _upperIndex(inner->keys(), inner->count, key);
+        path[level] = inner;
+        node = inner->children[pathIndex[level]];
+    }
+
+    auto* leaf = static_cast<LeafNode*>(node);
+    const size_t pos = _lowerIndex(leaf->keys(), leaf->count, key);
+    if (pos == leaf->count || key < leaf->keys()[pos])
+        return 0;
+
+    _eraseAt(leaf->keys(), leaf->count, pos);
+    _eraseAt(leaf->values(), leaf->count, pos);
+    --leaf->count;
+    --m_size;
+
+    _rebalanceLeaf(leaf, path, pathIndex);
+    return 1;
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::Iterator cads::BTreeMap<KeyType, ValType, NodeBytes>::erase(ConstIterator pos)
+{
+    // Rebalancing may move the successor into another node, so look it up again
+    KeyType key = pos.key();
+    erase(key);
+    return lowerBound(key);
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+void cads::BTreeMap<KeyType, ValType, NodeBytes>::clear() noexcept
+{
+    if (m_root != nullptr)
+        _destroy(m_root, 0);
+
+    m_root = nullptr;
+    m_head = nullptr;
+    m_tail = nullptr;
+    m_size = 0;
+    m_height = 0;
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+void cads::BTreeMap<KeyType, ValType, NodeBytes>::swap(BTreeMap& other) noexcept
+{
+    std::swap(m_root, other.m_root);
+    std::swap(m_head, other.m_head);
+    std::swap(m_tail, other.m_tail);
+    std::swap(m_size, other.m_size);
+    std::swap(m_height, other.m_height);
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+void cads::BTreeMap<KeyType, ValType, NodeBytes>::bulkLoad(const Vector<std::pair<KeyType, ValType>>& sorted)
+{
+    assert(std::adjacent_find(sorted.begin(), sorted.end(), [](const auto& lhs, const auto& rhs) {
+        return !(lhs.first < rhs.first);
+    }) == sorted.end() && "bulkLoad() requires strictly increasing keys");
+
+    clear();
+
+    size_t next = 0;
+    _buildSorted(sorted.size(), [&sorted, &next](KeyType* key, ValType* value) {
+        _constructEntry(key, value, sorted[next].first, sorted[next].second);
+        ++next;
+    });
+}
+
+// -- Private methods --
+template <typename KeyType, typename ValType, size_t NodeBytes>
+template <typename K, typename V>
+std::pair<typename cads::BTreeMap<KeyType, ValType, NodeBytes>::Iterator, bool>
+cads::BTreeMap<KeyType, ValType, NodeBytes>::_insert(K&& key, V&& value, const bool assign)
+{
+    if (m_root == nullptr)
+    {
+        auto* leaf = new LeafNode{};
+        new (leaf->keys()) KeyType(std::forward<K>(key));
+        new (leaf->values()) ValType(std::forward<V>(value));
+        leaf->count = 1;
+
+        m_root = leaf;
+        m_head = leaf;
+        m_tail = leaf;
+        m_size = 1;
+
+        return {Iterator{leaf, 0}, true};
+    }
+
+    InnerNode* path[MaxHeight];
+    size_t pathIndex[MaxHeight];
+
+    Node* node = m_root;
+    for (size_t level = 0; level < m_height; ++level)
+    {
+        auto* inner = static_cast<InnerNode*>(node);
+        pathIndex[level] = _upperIndex(inner->keys(), inner->count, key);
+        path[level] = inner;
+        node = inner->children[pathIndex[level]];
+    }
+
+    auto* leaf = static_cast<LeafNode*>(node);
+    const size_t pos = _lowerIndex(leaf->keys(), leaf->count, key);
+
+    if (pos < leaf->count && !(key < leaf->keys()[pos]))
+    {
+        if (assign)
+            leaf->values()[pos] = std::forward<V>(value);
+
+        return {Iterator{leaf, pos}, false};
+    }
+
+    if (leaf->count < LeafCapacity)
+    {
+        _insertAt(leaf->keys(), leaf->count, pos, KeyType(std::forward<K>(key)));
+        _insertAt(leaf->values(), leaf->count, pos, ValType(std::forward<V>(value)));
+        ++leaf->count;
+        ++m_size;
+
+        return {Iterator{leaf, pos}, true};
+    }
+
+    // Split the full leaf, then insert into whichever half owns the position
+    auto* right = new LeafNode{};
+    const size_t keep = LeafCapacity / 2;
+
+    _moveAppend(leaf->keys(), keep, leaf->count, right->keys(), 0);
+    _moveAppend(leaf->values(), keep, leaf->count, right->values(), 0);
+    right->count = leaf->count - keep;
+    leaf->count = keep;
+
+    right->prev = leaf;
+    right->next = leaf->next;
+    if (leaf->next != nullptr)
+        leaf->next->prev = right;
+    else
+        m_tail = right;
+    leaf->next = right;
+
+    LeafNode* target = pos <= keep ? leaf : right;
+    const size_t targetPos = pos <= keep ? pos : pos - keep;
+
+    _insertAt(target->keys(), target->count, targetPos, KeyType(std::forward<K>(key)));
+    _insertAt(target->values(), target->count, targetPos, ValType(std::forward<V>(value)));
+    ++target->count;
+    ++m_size;
+
+    _insertIntoParent(path, pathIndex, m_height, right->keys()[0], right);
+
+    return {Iterator{target, targetPos}, true};
+}
+
+// Hooks `rightChild` in after the child at `path[level - 1]`, splitting inner nodes upwards as needed
+template <typename KeyType, typename ValType, size_t NodeBytes>
+void cads::BTreeMap<KeyType, ValType, NodeBytes>::_insertIntoParent(InnerNode** path, const size_t* pathIndex,
+                                                                   size_t level, KeyType separator, Node* rightChild)
+{
+    while (level > 0)
+    {
+        InnerNode* inner = path[level - 1];
+        const size_t index = pathIndex[level - 1];
+
+        if (inner->count < InnerCapacity)
+        {
+            _insertAt(inner->keys(), inner->count, index, std::move(separator));
+            _insertAt(inner->children, inner->count + 1, index + 1, std::move(rightChild));
+            ++inner->count;
+            return;
+        }
+
+        // Split so that, counting the new separator, the left node keeps `half` keys,
+        // the median moves up and the rest goes to the new right sibling
+        auto* right = new InnerNode{};
+        const size_t half = InnerCapacity / 2;
+
+        if (index == half)
+        {
+            // The new separator is the median itself
+            _moveAppend(inner->keys(), half, inner->count, right->keys(), 0);
+            right->children[0] = rightChild;
+            _moveAppend(inner->children, half + 1, inner->count + 1, right->children, 1);
+            right->count = inner->count - half;
+            inner->count = half;
+        }
+        else
+        {
+            const size_t mid = index < half ? half - 1 : half;
+
+            KeyType up = std::move(inner->keys()[mid]);
+            _moveAppend(inner->keys(), mid + 1, inner->count, right->keys(), 0);
+            _moveAppend(inner->children, mid + 1, inner->count + 1, right->children, 0);
+            right->count = inner->count - mid - 1;
+            inner->keys()[mid].~KeyType();
+            inner->count = mid;
+
+            InnerNode* target = index < half ? inner : right;
+            const size_t targetIndex = index < half ? index : index - mid - 1;
+
+            _insertAt(target->keys(), target->count, targetIndex, std::move(separator));
+            _insertAt(target->children, target->count + 1, targetIndex + 1, std::move(rightChild));
+            ++target->count;
+
+            separator = std::move(up);
+        }
+
+        rightChild = right;
+        --level;
+    }
+
+    auto* root = new InnerNode{};
+    new (root->keys()) KeyType(std::move(separator));
+    root->children[0] = m_root;
+    root->children[1] = rightChild;
+    root->count = 1;
+
+    m_root = root;
+    ++m_height;
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+void cads::BTreeMap<KeyType, ValType, NodeBytes>::_rebalanceLeaf(LeafNode* leaf, InnerNode** path, const size_t* pathIndex)
+{
+    if (m_height == 0)
+    {
+        if (leaf->count == 0)
+        {
+            delete leaf;
+            m_root = nullptr;
+            m_head = nullptr;
+            m_tail = nullptr;
+        }
+        return;
+    }
+
+    if (leaf->count >= MinLeafCount)
+        return;
+
+    InnerNode* parent = path[m_height - 1];
+    const size_t index = pathIndex[m_height - 1];
+
+    auto* left = index > 0 ? static_cast<LeafNode*>(parent->children[index - 1]) : nullptr;
+    auto* right = index < parent->count ? static_cast<LeafNode*>(parent->children[index + 1]) : nullptr;
+
+    if (left != nullptr && left->count > MinLeafCount)
+    {
+        const size_t last = left->count - 1;
+        _insertAt(leaf->keys(), leaf->count, 0, std::move(left->keys()[last]));
+        _insertAt(leaf->values(), leaf->count, 0, std::move(left->values()[last]));
+        left->keys()[last].~KeyType();
+        left->values()[last].~ValType();
+        --left->count;
+        ++leaf->count;
+
+        parent->keys()[index - 1] = leaf->keys()[0];
+        return;
+    }
+
+    if (right != nullptr && right->count > MinLeafCount)
+    {
+        new (leaf->keys() + leaf->count) KeyType(std::move(right->keys()[0]));
+        new (leaf->values() + leaf->count) ValType(std::move(right->values()[0]));
+        ++leaf->count;
+        _eraseAt(right->keys(), right->count, 0);
+        _eraseAt(right->values(), right->count, 0);
+        --right->count;
+
+        parent->keys()[index] = right->keys()[0];
+        return;
+    }
+
+    // Neither sibling can spare an entry, so merge the right node of the pair into the left one
+    LeafNode* mergeLeft = left != nullptr ? left : leaf;
+    LeafNode* mergeRight = left != nullptr ? leaf : right;
+    const size_t separatorIndex = left != nullptr ? index - 1 : index;
+
+    _moveAppend(mergeRight->keys(), 0, mergeRight->count, mergeLeft->keys(), mergeLeft->count);
+    _moveAppend(mergeRight->values(), 0, mergeRight->count, mergeLeft->values(), mergeLeft->count);
+    mergeLeft->count += mergeRight->count;
+
+    mergeLeft->next = mergeRight->next;
+    if (mergeRight->next != nullptr)
+        mergeRight->next->prev = mergeLeft;
+    else
+        m_tail = mergeLeft;
+    delete mergeRight;
+
+    _eraseAt(parent->keys(), parent->count, separatorIndex);
+    _eraseAt(parent->children, parent->count + 1, separatorIndex + 1);
+    --parent->count;
+
+    _rebalanceInner(path, pathIndex, m_height - 1);
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+void cads::BTreeMap<KeyType, ValType, NodeBytes>::_rebalanceInner(InnerNode** path, const size_t* pathIndex, size_t level)
+{
+    while (true)
+    {
+        InnerNode* node = path[level];
+
+        if (level == 0)
+        {
+            // An inner root left with a single child hands the root over to it
+            if (node->count == 0)
+            {
+                m_root = node->children[0];
+                delete node;
+                --m_height;
+            }
+            return;
+        }
+
+        if (node->count >= MinInnerCount)
+            return;
+
+        InnerNode* parent = path[level - 1];
+        const size_t index = pathIndex[level - 1];
+
+        auto* left = index > 0 ? static_cast<InnerNode*>(parent->children[index - 1]) : nullptr;
+        auto* right = index < parent->count ? static_cast<InnerNode*>(parent->children[index + 1]) : nullptr;
+
+        if (left != nullptr && left->count > MinInnerCount)
+        {
+            // Rotate right through the parent separator
+            _insertAt(node->keys(), node->count, 0, std::move(parent->keys()[index - 1]));
+            _insertAt(node->children, node->count + 1, 0, std::move(left->children[left->count]));
+            ++node->count;
+
+            parent->keys()[index - 1] = std::move(left->keys()[left->count - 1]);
+            left->keys()[left->count - 1].~KeyType();
+            --left->count;
+            return;
+        }
+
+        if (right != nullptr && right->count > MinInnerCount)
+        {
+            // Rotate left through the parent separator
+            new (node->keys() + node->count) KeyType(std::move(parent->keys()[index]));
+            node->children[node->count + 1] = right->children[0];
+            ++node->count;
+
+            parent->keys()[index] = std::move(right->keys()[0]);
+            _eraseAt(right->keys(), right->count, 0);
+            _eraseAt(right->children, right->count + 1, 0);
+            --right->count;
+            return;
+        }
+
+        // Merge the pair around the parent separator, which moves down between them
+        InnerNode* mergeLeft = left != nullptr ? left : node;
+        InnerNode* mergeRight = left != nullptr ? node : right;
+        const size_t separatorIndex = left != nullptr ? index - 1 : index;
+
+        new (mergeLeft->keys() + mergeLeft->count) KeyType(std::move(parent->keys()[separatorIndex]));
+        _moveAppend(mergeRight->keys(), 0, mergeRight->count, mergeLeft->keys(), mergeLeft->count + 1);
+        _moveAppend(mergeRight->children, 0, mergeRight->count + 1, mergeLeft->children, mergeLeft->count + 1);
+        mergeLeft->count += mergeRight->count + 1;
+        delete mergeRight;
+
+        _eraseAt(parent->keys(), parent->count, separatorIndex);
+        _eraseAt(parent->children, parent->count + 1, separatorIndex + 1);
+        --parent->count;
+
+        --level;
+    }
+}
+
+// Builds the tree bottom-up, spreading entries evenly so every node is at least half full.
+// `construct(key, value)` placement-constructs the next entry in order, both or neither.
+// If it throws, everything built so far is freed and the map is left empty.
+template <typename KeyType, typename ValType, size_t NodeBytes>
+template <typename Construct>
+void cads::BTreeMap<KeyType, ValType, NodeBytes>::_buildSorted(const size_t count, Construct&& construct)
+{
+    if (count == 0)
+        return;
+
+    const size_t leafCount = (count + LeafCapacity - 1) / LeafCapacity;
+
+    size_t innerTotal = 0;
+    for (size_t nodes = leafCount; nodes > 1;)
+    {
+        nodes = (nodes + InnerCapacity) / (InnerCapacity + 1);
+        innerTotal += nodes;
+    }
+
+    // Nothing hangs off m_root until the end, so the nodes built so far are tracked here
+    // (inner nodes) and through the leaf chain from m_head (leaves)
+    Vector<InnerNode*> inners;
+    inners.reserve(innerTotal);
+
+    try
+    {
+        Vector<Node*> level;
+        Vector<LeafNode*> firstLeaves; // Leftmost leaf below each node of `level`
+        level.reserve(leafCount);
+        firstLeaves.reserve(leafCount);
+
+        LeafNode* prev = nullptr;
+        for (size_t i = 0; i < leafCount; ++i)
+        {
+            const size_t entries = count / leafCount + (i < count % leafCount ? 1 : 0);
+
+            auto* leaf = new LeafNode{};
+            leaf->prev = prev;
+            if (prev != nullptr)
+                prev->next = leaf;
+            else
+                m_head = leaf;
+            prev = leaf;
+
+            for (size_t j = 0; j < entries; ++j)
+            {
+                construct(leaf->keys() + j, leaf->values() + j);
+                ++leaf->count;
+            }
+
+            level.pushBack(leaf);
+            firstLeaves.pushBack(leaf);
+        }
+
+        m_tail = prev;
+
+        while (level.size() > 1)
+        {
+            const size_t parentCount = (level.size() + InnerCapacity) / (InnerCapacity + 1);
+
+            Vector<Node*> parents;
+            Vector<LeafNode*> parentFirstLeaves;
+            parents.reserve(parentCount);
+            parentFirstLeaves.reserve(parentCount);
+
+            size_t next = 0;
+            for (size_t i = 0; i < parentCount; ++i)
+            {
+                const size_t children = level.size() / parentCount + (i < level.size() % parentCount ? 1 : 0);
+
+                auto* inner = new InnerNode{};
+                inners.pushBack(inner);
+
+                inner->children[0] = level[next];
+                for (size_t j = 1; j < children; ++j)
+                {
+                    new (inner->keys() + j - 1) KeyType(firstLeaves[next + j]->keys()[0]);
+                    inner->children[j] = level[next + j];
+                    inner->count = j;
+                }
+
+                parents.pushBack(inner);
+                parentFirstLeaves.pushBack(firstLeaves[next]);
+                next += children;
+            }
+
+            level = std::move(parents);
+            firstLeaves = std::move(parentFirstLeaves);
+            ++m_height;
+        }
+
+        m_root = level[0];
+        m_size = count;
+    }
+    catch (...)
+    {
+        _discardBuild(inners);
+        throw;
+    }
+}
+
+// Constructs both halves of an entry or, if the value throws, neither
+template <typename KeyType, typename ValType, size_t NodeBytes>
+void cads::BTreeMap<KeyType, ValType, NodeBytes>::_constructEntry(KeyType* key, ValType* value,
+                                                                 const KeyType& sourceKey, const ValType& sourceValue)
+{
+    new (key) KeyType(sourceKey);
+    try
+    {
+        new (value) ValType(sourceValue);
+    }
+    catch (...)
+    {
+        key->~KeyType();
+        throw;
+    }
+}
+
+// Frees a build abandoned by an exception: the given inner nodes and the leaf chain
+template <typename KeyType, typename ValType, size_t NodeBytes>
+void cads::BTreeMap<KeyType, ValType, NodeBytes>::_discardBuild(const Vector<InnerNode*>& inners) noexcept
+{
+    for (InnerNode* inner : inners)
+    {
+        if constexpr (!std::is_trivially_destructible_v<KeyType>)
+        {
+            for (size_t i = 0; i < inner->count; ++i)
+                inner->keys()[i].~KeyType();
+        }
+        delete inner;
+    }
+
+    for (LeafNode* leaf = m_head; leaf != nullptr;)
+    {
+        LeafNode* next = leaf->next;
+        for (size_t i = 0; i < leaf->count; ++i)
+        {
+            leaf->keys()[i].~KeyType();
+            leaf->values()[i].~ValType();
+        }
+        delete leaf;
+        leaf = next;
+    }
+
+    m_root = nullptr;
+    m_head = nullptr;
+    m_tail = nullptr;
+    m_size = 0;
+    m_height = 0;
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::LeafNode* cads::BTreeMap<KeyType, ValType, NodeBytes>::_findLeaf(const KeyType& key) const
+{
+    Node* node = m_root;
+    for (size_t level = 0; level < m_height; ++level)
+    {
+        auto* inner = static_cast<InnerNode*>(node);
+        node = inner->children[_upperIndex(inner->keys(), inner->count, key)];
+    }
+
+    return static_cast<LeafNode*>(node);
+}
+
+// Positions one past the last entry of a leaf belong to the next leaf, except for end()
+template <typename KeyType, typename ValType, size_t NodeBytes>
+typename cads::BTreeMap<KeyType, ValType, NodeBytes>::Iterator cads::BTreeMap<KeyType, ValType, NodeBytes>::_makeIterator(LeafNode* leaf, const size_t index) const
+{
+    if (index == leaf->count && leaf->next != nullptr)
+        return Iterator{leaf->next, 0};
+
+    return Iterator{leaf, index};
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+void cads::BTreeMap<KeyType, ValType, NodeBytes>::_destroy(Node* node, const size_t level) noexcept
+{
+    if (level == m_height)
+    {
+        auto* leaf = static_cast<LeafNode*>(node);
+        if constexpr (!std::is_trivially_destructible_v<KeyType> || !std::is_trivially_destructible_v<ValType>)
+        {
+            for (size_t i = 0; i < leaf->count; ++i)
+            {
+                leaf->keys()[i].~KeyType();
+                leaf->values()[i].~ValType();
+            }
+        }
+        delete leaf;
+        return;
+    }
+
+    auto* inner = static_cast<InnerNode*>(node);
+    for (size_t i = 0; i <= inner->count; ++i)
+        _destroy(inner->children[i], level + 1);
+
+    if constexpr (!std::is_trivially_destructible_v<KeyType>)
+    {
+        for (size_t i = 0; i < inner->count; ++i)
+            inner->keys()[i].~KeyType();
+    }
+    delete inner;
+}
+
+// Number of keys less than `key`. Arithmetic keys are counted without branches so the
+// compiler can vectorize the scan over the node.
+template <typename KeyType, typename ValType, size_t NodeBytes>
+size_t cads::BTreeMap<KeyType, ValType, NodeBytes>::_lowerIndex(const KeyType* keys, const size_t count, const KeyType& key)
+{
+    if constexpr (std::is_arithmetic_v<KeyType>)
+    {
+        size_t index = 0;
+        for (size_t i = 0; i < count; ++i)
+            index += static_cast<size_t>(keys[i] < key);
+        return index;
+    }
+    else
+    {
+        size_t index = 0;
+        while (index < count && keys[index] < key)
+            ++index;
+        return index;
+    }
+}
+
+// Number of keys less than or equal to `key`
+template <typename KeyType, typename ValType, size_t NodeBytes>
+size_t cads::BTreeMap<KeyType, ValType, NodeBytes>::_upperIndex(const KeyType* keys, const size_t count, const KeyType& key)
+{
+    if constexpr (std::is_arithmetic_v<KeyType>)
+    {
+        size_t index = 0;
+        for (size_t i = 0; i < count; ++i)
+            index += static_cast<size_t>(!(key < keys[i]));
+        return index;
+    }
+    else
+    {
+        size_t index = 0;
+        while (index < count && !(key < keys[index]))
+            ++index;
+        return index;
+    }
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+template <typename T>
+void cads::BTreeMap<KeyType, ValType, NodeBytes>::_insertAt(T* items, const size_t count, const size_t pos, T&& value)
+{
+    if (pos == count)
+    {
+        new (items + count) T(std::move(value));
+        return;
+    }
+
+    new (items + count) T(std::move(items[count - 1]));
+    for (size_t i = count - 1; i > pos; --i)
+        items[i] = std::move(items[i - 1]);
+
+    items[pos] = std::move(value);
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+template <typename T>
+void cads::BTreeMap<KeyType, ValType, NodeBytes>::_eraseAt(T* items, const size_t count, const size_t pos)
+{
+    for (size_t i = pos; i + 1 < count; ++i)
+        items[i] = std::move(items[i + 1]);
+
+    items[count - 1].~T();
+}
+
+template <typename KeyType, typename ValType, size_t NodeBytes>
+template <typename T>
+void cads::BTreeMap<KeyType, ValType, NodeBytes>::_moveAppend(T* source, const size_t first, const size_t last,
+                                                             T* destination, const size_t destinationCount)
+{
+    for (size_t i = first; i < last; ++i)
+    {
+        new (destination + destinationCount + (i - first)) T(std::move(source[i]));
+        source[i].~T();
+    }
+}
@@ -0,0 +1,317 @@
+#pragma once
+
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <utility>
+
+namespace cads
+{
+
+// Bounded FIFO for passing values between coroutines: `co_await ch.push(v)` suspends while
+// the ring is full, `co_await ch.pop()` while it is empty. A capacity of 0 makes every push
+// a rendezvous with a pop.
+// The awaiters themselves are the waiter list nodes, so suspending never allocates.
+// A coroutine unblocked by a push/pop/close() is not resumed inline: it is handed to the
+// executor's post() once the channel lock has been released, so long hand-off chains cannot
+// grow the stack and every coroutine keeps running on its executor's threads.
+template<typename ValType>
+class Channel
+{
+    struct WaiterBase
+    {
+        std::coroutine_handle<> handle;
+        WaiterBase* next = nullptr;
+    };
+
+    // Intrusive FIFO of suspended awaiters, guarded by the channel mutex
+    class WaiterList
+    {
+    public:
+        [[nodiscard]] bool empty() const noexcept { return m_head == nullptr; }
+
+        void pushBack(WaiterBase* waiter) noexcept
+        {
+            waiter->next = nullptr;
+            if (m_tail == nullptr)
+                m_head = waiter;
+            else
+                m_tail->next = waiter;
+            m_tail = waiter;
+        }
+
+        WaiterBase* popFront() noexcept
+        {
+            WaiterBase* waiter = m_head;
+            m_head = waiter->next;
+            if (m_head == nullptr)
+                m_tail = nullptr;
+            return waiter;
+        }
+
+        WaiterBase* takeAll() noexcept
+        {
+            WaiterBase* head = m_head;
+            m_head = m_tail = nullptr;
+            return head;
+        }
+
+    private:
+        WaiterBase* m_head = nullptr;
+        WaiterBase* m_tail = nullptr;
+    };
+
+public:
+    using value_type = ValType;
+    using size_type  = std::size_t;
+
+    class PushAwaiter : private WaiterBase
+    {
+    public:
+        PushAwaiter(const PushAwaiter&) = delete;
+        PushAwaiter& operator=(const PushAwaiter&) = delete;
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> handle)
+        {
+            this->handle = handle;
+            return m_channel->_suspendPush(*this);
+        }
+
+        // False if the channel was closed before the value could be delivered
+        bool await_resume() noexcept { return m_delivered; }
+
+    private:
+        friend class Channel;
+
+        Channel* m_channel;
+        ValType m_value;
+        bool m_delivered = false;
+
+        PushAwaiter(Channel* channel, ValType&& value)
+            : m_channel{channel}
+            , m_value{std::move(value)}
+        { }
+    };
+
+    class PopAwaiter : private WaiterBase
+    {
+    public:
+        PopAwaiter(const PopAwaiter&) = delete;
+        PopAwaiter& operator=(const PopAwaiter&) = delete;
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> handle)
+        {
+            this->handle = handle;
+            return m_channel->_suspendPop(*this);
+        }
+
+        // Empty once the channel is closed and drained
+        std::optional<ValType> await_resume() { return std::move(m_result); }
+
+    private:
+        friend class Channel;
+
+        Channel* m_channel;
+        std::optional<ValType> m_result;
+
+        explicit PopAwaiter(Channel* channel)
+            : m_channel{channel}
+        { }
+    };
+
+
+    // -- Constructors --
+    // `executor` (e.g. a SingleThreadExecutor) must outlive the channel
+    template<typename Executor>
+        requires requires(Executor& executor, std::coroutine_handle<> handle) { executor.post(handle); }
+    explicit Channel(Executor& executor, const size_type capacity = 0)
+        : m_buffer{capacity == 0 ? nullptr : static_cast<ValType*>(operator new(capacity * sizeof(ValType)))}
+        , m_capacity{capacity}
+        , m_executor{&executor}
+        , m_post{[](void* target, const std::coroutine_handle<> handle) {
+            static_cast<Executor*>(target)->post(handle);
+        }}
+    { }
+
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
+
+    // No coroutine may still be suspended on the channel
+    ~Channel()
+    {
+        assert(m_pushers.empty() && m_poppers.empty() && "Channel destroyed with suspended waiters");
+
+        for (size_type i = 0; i < m_size; ++i)
+            m_buffer[_slot(i)].~ValType();
+        operator delete(m_buffer);
+    }
+
+
+    [[nodiscard]] PushAwaiter push(ValType value)
+    {
+        return PushAwaiter{this, std::move(value)};
+    }
+
+    [[nodiscard]] PopAwaiter pop()
+    {
+        return PopAwaiter{this};
+    }
+
+    // Wakes every suspended coroutine: pending pushes report false, pending pops get an
+    // empty optional. Values already buffered can still be popped.
+    void close()
+    {
+        WaiterBase* pushers;
+        WaiterBase* poppers;
+        {
+            std::lock_guard lock{m_mutex};
+            m_closed = true;
+            pushers = m_pushers.takeAll();
+            poppers = m_poppers.takeAll();
+        }
+
+        // Read `next` first: a woken coroutine may already be running and destroy its awaiter
+        for (WaiterBase* waiter = pushers; waiter != nullptr;)
+        {
+            WaiterBase* next = waiter->next;
+            _wake(waiter);
+            waiter = next;
+        }
+        for (WaiterBase* waiter = poppers; waiter != nullptr;)
+        {
+            WaiterBase* next = waiter->next;
+            _wake(waiter);
+            waiter = next;
+        }
+    }
+
+    [[nodiscard]] bool isClosed() const
+    {
+        std::lock_guard lock{m_mutex};
+        return m_closed;
+    }
+
+    // Number of buffered values, not counting suspended pushes
+    [[nodiscard]] size_type size() const
+    {
+        std::lock_guard lock{m_mutex};
+        return m_size;
+    }
+
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+private:
+    ValType* m_buffer;
+    const size_type m_capacity;
+    size_type m_head = 0;
+    size_type m_size = 0;
+    bool m_closed = false;
+
+    WaiterList m_pushers;
+    WaiterList m_poppers;
+    mutable std::mutex m_mutex;
+
+    void* m_executor;
+    void (*m_post)(void* executor, std::coroutine_handle<> handle);
+
+    void _wake(WaiterBase* waiter)
+    {
+        m_post(m_executor, waiter->handle);
+    }
+
+    // Returns whether the pushing coroutine stays suspended
+    bool _suspendPush(PushAwaiter& pusher)
+    {
+        std::unique_lock lock{m_mutex};
+
+        if (m_closed)
+            return false;
+
+        if (!m_poppers.empty())
+        {
+            // Only possible while the ring is empty: hand the value over directly
+            auto* popper = static_cast<PopAwaiter*>(m_poppers.popFront());
+            popper->m_result.emplace(std::move(pusher.m_value));
+            pusher.m_delivered = true;
+
+            lock.unlock();
+            _wake(popper);
+            return false;
+        }
+
+        if (m_size < m_capacity)
+        {
+            new (m_buffer + _slot(m_size)) ValType(std::move(pusher.m_value));
+            ++m_size;
+            pusher.m_delivered = true;
+            return false;
+        }
+
+        m_pushers.pushBack(&pusher);
+        return true;
+    }
+
+    bool _suspendPop(PopAwaiter& popper)
+    {
+        std::unique_lock lock{m_mutex};
+
+        PushAwaiter* pusher = m_pushers.empty() ? nullptr : static_cast<PushAwaiter*>(m_pushers.popFront());
+
+        if (m_size > 0)
+        {
+            ValType& front = m_buffer[m_head];
+            popper.m_result.emplace(std::move(front));
+            front.~ValType();
+
+            m_head = _slot(1);
+            --m_size;
+
+            // A suspended pusher takes the slot that just became free
+            if (pusher != nullptr)
+            {
+                new (m_buffer + _slot(m_size)) ValType(std::move(pusher->m_value));
+                ++m_size;
+            }
+        }
+        else if (pusher != nullptr)
+        {
+            // Unbuffered (rendezvous) hand-over
+            popper.m_result.emplace(std::move(pusher->m_value));
+        }
+        else
+        {
+            if (m_closed)
+                return false;
+
+            m_poppers.pushBack(&popper);
+            return true;
+        }
+
+        if (pusher != nullptr)
+        {
+            pusher->m_delivered = true;
+            lock.unlock();
+            _wake(pusher);
+        }
+        return false;
+    }
+
+    // Ring position `offset` elements after the head
+    size_type _slot(const size_type offset) const noexcept
+    {
+        const size_type index = m_head + offset;
+        return index >= m_capacity ? index - m_capacity : index;
+    }
+};
+
+} // namespace cads
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <type_traits>
+
+namespace cads
+{
+
+// Ring of the last `capacity()` values: pushBack() on a full buffer overwrites the oldest
+// element. `Capacity` fixes the size at compile time with inline storage; leave it as
+// std::dynamic_extent to pick the capacity at runtime (heap storage).
+// Indices and iterators follow the logical order, oldest first.
+template<typename ValType, std::size_t Capacity = std::dynamic_extent>
+class CircularBuffer
+{
+    static_assert(Capacity > 0, "CircularBuffer needs room for at least one element");
+
+    static constexpr bool IsDynamic = Capacity == std::dynamic_extent;
+
+public:
+    class Iterator;
+    class ConstIterator;
+
+    using value_type      = ValType;
+    using size_type       = std::size_t;
+    using reference       = ValType&;
+    using const_reference = const ValType&;
+    using pointer         = ValType*;
+    using const_pointer   = const ValType*;
+    using iterator        = Iterator;
+    using const_iterator  = ConstIterator;
+
+    // -- Iterators --
+    class Iterator
+    {
+    public:
+        // For integration with STL algorithms
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = ValType;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = ValType*;
+        using reference         = ValType&;
+
+        friend class ConstIterator;
+
+        Iterator() = default;
+        Iterator(CircularBuffer* buffer, std::ptrdiff_t index) : m_buffer(buffer), m_index(index) {}
+
+        ValType& operator*() const { return (*m_buffer)[m_index]; }
+        ValType* operator->() const { return &(*m_buffer)[m_index]; }
+
+        Iterator& operator++() { ++m_index; return *this; }
+        Iterator operator++(int) { auto temp = *this; ++m_index; return temp; }
+        Iterator& operator--() { --m_index; return *this; }
+        Iterator operator--(int) { auto temp = *this; --m_index; return temp; }
+
+        Iterator& operator+=(std::ptrdiff_t n) { m_index += n; return *this; }
+        Iterator& operator-=(std::ptrdiff_t n) { m_index -= n; return *this; }
+
+        Iterator operator+(std::ptrdiff_t n) const { return Iterator(m_buffer, m_index + n); }
+        Iterator operator-(std::ptrdiff_t n) const { return Iterator(m_buffer, m_index - n); }
+        std::ptrdiff_t operator-(const Iterator& other) const { return m_index - other.m_index; }
+
+        friend Iterator operator+(std::ptrdiff_t n, const Iterator& it) { return it + n; }
+
+        ValType& operator[](std::ptrdiff_t n) const { return (*m_buffer)[m_index + n]; }
+
+        bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+        auto operator<=>(const Iterator& other) const { return m_index <=> other.m_index; }
+
+    private:
+        CircularBuffer* m_buffer = nullptr;
+        std::ptrdiff_t m_index = 0;
+    };
+
+    class ConstIterator
+    {
+    public:
+        // For integration with STL algorithms
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = ValType;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const ValType*;
+        using reference         = const ValType&;
+
+        ConstIterator() = default;
+        ConstIterator(const CircularBuffer* buffer, std::ptrdiff_t index) : m_buffer(buffer), m_index(index) {}
+
+        ConstIterator(const Iterator& it) : m_buffer(it.m_buffer), m_index(it.m_index) {}
+
+        const ValType& operator*() const { return (*m_buffer)[m_index]; }
+        const ValType* operator->() const { return &(*m_buffer)[m_index]; }
+
+        ConstIterator& operator++() { ++m_index; return *this; }
+        ConstIterator operator++(int) { auto temp = *this; ++m_index; return temp; }
+        ConstIterator& operator--() { --m_index; return *this; }
+        ConstIterator operator--(int) { auto temp = *this; --m_index; return temp; }
+
+        ConstIterator& operator+=(std::ptrdiff_t n) { m_index += n; return *this; }
+        ConstIterator& operator-=(std::ptrdiff_t n) { m_index -= n; return *this; }
+
+        ConstIterator operator+(std::ptrdiff_t n) const { return ConstIterator(m_buffer, m_index + n); }
+        ConstIterator operator-(std::ptrdiff_t n) const { return ConstIterator(m_buffer, m_index - n); }
+        std::ptrdiff_t operator-(const ConstIterator& other) const { return m_index - other.m_index; }
+
+        friend ConstIterator operator+(std::ptrdiff_t n, const ConstIterator& it) { return it + n; }
+
+        const ValType& operator[](std::ptrdiff_t n) const { return (*m_buffer)[m_index + n]; }
+
+        bool operator==(const ConstIterator& other) const { return m_index == other.m_index; }
+        auto operator<=>(const ConstIterator& other) const { return m_index <=> other.m_index; }
+
+    private:
+        const CircularBuffer* m_buffer = nullptr;
+        std::ptrdiff_t m_index = 0;
+    };
+
+    using ReverseIterator = std::reverse_iterator<Iterator>;
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+    // -- Constructors --
+    CircularBuffer() requires (!IsDynamic);
+    // Throws std::invalid_argument for a capacity of 0
+    explicit CircularBuffer(size_type capacity) requires IsDynamic;
+    CircularBuffer(const CircularBuffer& other);
+    CircularBuffer(CircularBuffer&& other) noexcept(IsDynamic || std::is_nothrow_move_constructible_v<ValType>);
+    CircularBuffer& operator=(const CircularBuffer& other);
+    CircularBuffer& operator=(CircularBuffer&& other) noexcept(IsDynamic || std::is_nothrow_move_constructible_v<ValType>);
+
+    // -- Destructor --
+    ~CircularBuffer();
+
+    // -- Methods --
+    // - Access -
+    // Logical index, 0 is the oldest element
+    ValType& operator[](size_type index);
+    const ValType& operator[](size_type index) const;
+    ValType& at(size_type index);
+    const ValType& at(size_type index) const;
+
+    ValType& front();
+    const ValType& front() const;
+    ValType& back();
+    const ValType& back() const;
+
+    // Rearranges the storage so the elements are contiguous in logical order and returns
+    // them; invalidates references. Free when the contents do not wrap around.
+    std::span<ValType> linearize();
+
+    // - Iterator methods -
+    Iterator begin() noexcept;
+    ConstIterator begin() const noexcept;
+    Iterator end() noexcept;
+    ConstIterator end() const noexcept;
+
+    ConstIterator cbegin() const noexcept;
+    ConstIterator cend() const noexcept;
+
+    ReverseIterator rbegin() noexcept;
+    ConstReverseIterator rbegin() const noexcept;
+    ReverseIterator rend() noexcept;
+    ConstReverseIterator rend() const noexcept;
+
+    // - Capacity -
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] bool full() const noexcept;
+
+    // - Modifiers -
+    // Overwrites the oldest element when full. A moved-from dynamic buffer has no storage
+    // left: these throw std::logic_error until it is assigned a new one.
+    void pushBack(const ValType& value);
+    void pushBack(ValType&& value);
+    template<typename... Args>
+    ValType& emplaceBack(Args&&... args);
+
+    void popFront();
+    void popBack();
+    void clear() noexcept;
+
+private:
+    struct InlineStorage
+    {
+        alignas(ValType) unsigned char bytes[sizeof(ValType) * (IsDynamic ? 1 : Capacity)];
+    };
+
+    struct HeapStorage
+    {
+        ValType* data = nullptr;
+        size_type capacity = 0;
+    };
+
+    std::conditional_t<IsDynamic, HeapStorage, InlineStorage> m_storage;
+    size_type m_head = 0; // Physical slot of the oldest element
+    size_type m_size = 0;
+
+    ValType* _data() noexcept;
+    const ValType* _data() const noexcept;
+
+    // Maps head + offset (< 2 * capacity) to a physical slot without dividing
+    size_type _wrap(size_type index) const noexcept;
+
+    void _moveFrom(CircularBuffer& other);
+};
+
+} // namespace cads
+
+#include "cads/circular_buffer.tpp"
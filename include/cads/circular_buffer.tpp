@@ -0,0 +1,412 @@
+#pragma once
+
+#include "cads/vector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+// -- Constructors --
+template <typename ValType, std::size_t Capacity>
+cads::CircularBuffer<ValType, Capacity>::CircularBuffer() requires (!IsDynamic)
+{ }
+
+template <typename ValType, std::size_t Capacity>
+cads::CircularBuffer<ValType, Capacity>::CircularBuffer(const size_type capacity) requires IsDynamic
+{
+    if (capacity == 0)
+        throw std::invalid_argument("CircularBuffer: capacity must be at least 1");
+
+    m_storage.data = static_cast<ValType*>(operator new(capacity * sizeof(ValType)));
+    m_storage.capacity = capacity;
+}
+
+template <typename ValType, std::size_t Capacity>
+cads::CircularBuffer<ValType, Capacity>::CircularBuffer(const CircularBuffer& other)
+{
+    if constexpr (IsDynamic)
+    {
+        m_storage.data = static_cast<ValType*>(operator new(other.capacity() * sizeof(ValType)));
+        m_storage.capacity = other.capacity();
+    }
+
+    try
+    {
+        for (const ValType& value : other)
+        {
+            new (_data() + m_size) ValType(value);
+            ++m_size;
+        }
+    }
+    catch (...)
+    {
+        clear();
+        if constexpr (IsDynamic)
+            operator delete(m_storage.data);
+        throw;
+    }
+}
+
+template <typename ValType, std::size_t Capacity>
+cads::CircularBuffer<ValType, Capacity>::CircularBuffer(CircularBuffer&& other)
+    noexcept(IsDynamic || std::is_nothrow_move_constructible_v<ValType>)
+{
+    _moveFrom(other);
+}
+
+template <typename ValType, std::size_t Capacity>
+cads::CircularBuffer<ValType, Capacity>& cads::CircularBuffer<ValType, Capacity>::operator=(const CircularBuffer& other)
+{
+    if (this != &other)
+    {
+        CircularBuffer temp{other};
+        *this = std::move(temp);
+    }
+
+    return *this;
+}
+
+template <typename ValType, std::size_t Capacity>
+cads::CircularBuffer<ValType, Capacity>& cads::CircularBuffer<ValType, Capacity>::operator=(CircularBuffer&& other)
+    noexcept(IsDynamic || std::is_nothrow_move_constructible_v<ValType>)
+{
+    if (this != &other)
+    {
+        clear();
+        if constexpr (IsDynamic)
+        {
+            operator delete(m_storage.data);
+            m_storage = HeapStorage{};
+        }
+
+        _moveFrom(other);
+    }
+
+    return *this;
+}
+
+// -- Destructor --
+template <typename ValType, std::size_t Capacity>
+cads::CircularBuffer<ValType, Capacity>::~CircularBuffer()
+{
+    clear();
+    if constexpr (IsDynamic)
+        operator delete(m_storage.data);
+}
+
+// -- Methods --
+// - Access -
+template <typename ValType, std::size_t Capacity>
+ValType& cads::CircularBuffer<ValType, Capacity>::operator[](const size_type index)
+{
+    return _data()[_wrap(m_head + index)];
+}
+
+template <typename ValType, std::size_t Capacity>
+const ValType& cads::CircularBuffer<ValType, Capacity>::operator[](const size_type index) const
+{
+    return _data()[_wrap(m_head + index)];
+}
+
+template <typename ValType, std::size_t Capacity>
+ValType& cads::CircularBuffer<ValType, Capacity>::at(const size_type index)
+{
+    if (index >= m_size)
+        throw std::out_of_range("CircularBuffer::at: index out of range");
+
+    return (*this)[index];
+}
+
+template <typename ValType, std::size_t Capacity>
+const ValType& cads::CircularBuffer<ValType, Capacity>::at(const size_type index) const
+{
+    if (index >= m_size)
+        throw std::out_of_range("CircularBuffer::at: index out of range");
+
+    return (*this)[index];
+}
+
+template <typename ValType, std::size_t Capacity>
+ValType& cads::CircularBuffer<ValType, Capacity>::front()
+{
+    assert(!empty() && "CircularBuffer::front: buffer is empty");
+    return _data()[m_head];
+}
+
+template <typename ValType, std::size_t Capacity>
+const ValType& cads::CircularBuffer<ValType, Capacity>::front() const
+{
+    assert(!empty() && "CircularBuffer::front: buffer is empty");
+    return _data()[m_head];
+}
+
+template <typename ValType, std::size_t Capacity>
+ValType& cads::CircularBuffer<ValType, Capacity>::back()
+{
+    assert(!empty() && "CircularBuffer::back: buffer is empty");
+    return (*this)[m_size - 1];
+}
+
+template <typename ValType, std::size_t Capacity>
+const ValType& cads::CircularBuffer<ValType, Capacity>::back() const
+{
+    assert(!empty() && "CircularBuffer::back: buffer is empty");
+    return (*this)[m_size - 1];
+}
+
+template <typename ValType, std::size_t Capacity>
+std::span<ValType> cads::CircularBuffer<ValType, Capacity>::linearize()
+{
+    ValType* data = _data();
+
+    if (m_head + m_size <= capacity())
+        return {data + m_head, m_size};
+
+    if (m_size == capacity())
+    {
+        // No free slot: rotate the whole ring in place
+        std::rotate(data, data + m_head, data + m_size);
+    }
+    else
+    {
+        // The free gap sits between the two runs, so shuffle through a scratch buffer
+        Vector<ValType> scratch;
+        scratch.reserve(m_size);
+        for (size_type i = 0; i < m_size; ++i)
+            scratch.pushBack(std::move((*this)[i]));
+
+        clear();
+        for (ValType& value : scratch)
+        {
+            new (data + m_size) ValType(std::move(value));
+            ++m_size;
+        }
+    }
+
+    m_head = 0;
+    return {data, m_size};
+}
+
+// - Iterator methods -
+template <typename ValType, std::size_t Capacity>
+typename cads::CircularBuffer<ValType, Capacity>::Iterator cads::CircularBuffer<ValType, Capacity>::begin() noexcept
+{
+    return Iterator(this, 0);
+}
+
+template <typename ValType, std::size_t Capacity>
+typename cads::CircularBuffer<ValType, Capacity>::ConstIterator cads::CircularBuffer<ValType, Capacity>::begin() const noexcept
+{
+    return ConstIterator(this, 0);
+}
+
+template <typename ValType, std::size_t Capacity>
+typename cads::CircularBuffer<ValType, Capacity>::Iterator cads::CircularBuffer<ValType, Capacity>::end() noexcept
+{
+    return Iterator(this, static_cast<std::ptrdiff_t>(m_size));
+}
+
+template <typename ValType, std::size_t Capacity>
+typename cads::CircularBuffer<ValType, Capacity>::ConstIterator cads::CircularBuffer<ValType, Capacity>::end() const noexcept
+{
+    return ConstIterator(this, static_cast<std::ptrdiff_t>(m_size));
+}
+
+template <typename ValType, std::size_t Capacity>
+typename cads::CircularBuffer<ValType, Capacity>::ConstIterator cads::CircularBuffer<ValType, Capacity>::cbegin() const noexcept
+{
+    return begin();
+}
+
+template <typename ValType, std::size_t Capacity>
+typename cads::CircularBuffer<ValType, Capacity>::ConstIterator cads::CircularBuffer<ValType, Capacity>::cend() const noexcept
+{
+    return end();
+}
+
+template <typename ValType, std::size_t Capacity>
+typename cads::CircularBuffer<ValType, Capacity>::ReverseIterator cads::CircularBuffer<ValType, Capacity>::rbegin() noexcept
+{
+    return ReverseIterator(end());
+}
+
+template <typename ValType, std::size_t Capacity>
+typename cads::CircularBuffer<ValType, Capacity>::ConstReverseIterator cads::CircularBuffer<ValType, Capacity>::rbegin() const noexcept
+{
+    return ConstReverseIterator(end());
+}
+
+template <typename ValType, std::size_t Capacity>
+typename cads::CircularBuffer<ValType, Capacity>::ReverseIterator cads::CircularBuffer<ValType, Capacity>::rend() noexcept
+{
+    return ReverseIterator(begin());
+}
+
+template <typename ValType, std::size_t Capacity>
+typename cads::CircularBuffer<ValType, Capacity>::ConstReverseIterator cads::CircularBuffer<ValType, Capacity>::rend() const noexcept
+{
+    return ConstReverseIterator(begin());
+}
+
+// - Capacity -
+template <typename ValType, std::size_t Capacity>
+typename cads::CircularBuffer<ValType, Capacity>::size_type cads::CircularBuffer<ValType, Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+template <typename ValType, std::size_t Capacity>
+typename cads::CircularBuffer<ValType, Capacity>::size_type cads::CircularBuffer<ValType, Capacity>::capacity() const noexcept
+{
+    if constexpr (IsDynamic)
+        return m_storage.capacity;
+    else
+        return Capacity;
+}
+
+template <typename ValType, std::size_t Capacity>
+bool cads::CircularBuffer<ValType, Capacity>::empty() const noexcept
+{
+    return m_size == 0;
+}
+
+template <typename ValType, std::size_t Capacity>
+bool cads::CircularBuffer<ValType, Capacity>::full() const noexcept
+{
+    return m_size == capacity();
+}
+
+// - Modifiers -
+template <typename ValType, std::size_t Capacity>
+void cads::CircularBuffer<ValType, Capacity>::pushBack(const ValType& value)
+{
+    emplaceBack(value);
+}
+
+template <typename ValType, std::size_t Capacity>
+void cads::CircularBuffer<ValType, Capacity>::pushBack(ValType&& value)
+{
+    emplaceBack(std::move(value));
+}
+
+template <typename ValType, std::size_t Capacity>
+template <typename... Args>
+ValType& cads::CircularBuffer<ValType, Capacity>::emplaceBack(Args&&... args)
+{
+    if constexpr (IsDynamic)
+    {
+        if (capacity() == 0)
+            throw std::logic_error("CircularBuffer::emplaceBack: moved-from buffer has no storage");
+    }
+
+    ValType* data = _data();
+    const size_type slot = _wrap(m_head + m_size);
+
+    if constexpr (std::is_trivially_destructible_v<ValType> && std::is_nothrow_constructible_v<ValType, Args&&...>)
+    {
+        // Nothing to destroy in the overwritten slot, so "full" only steers two cmovs
+        const bool wasFull = m_size == capacity();
+        ValType* value = new (data + slot) ValType(std::forward<Args>(args)...);
+
+        m_head = _wrap(m_head + wasFull);
+        m_size += !wasFull;
+        return *value;
+    }
+    else
+    {
+        if (m_size == capacity())
+        {
+            // Build first: the arguments may refer to the element being replaced
+            data[slot] = ValType(std::forward<Args>(args)...);
+            m_head = _wrap(m_head + 1);
+            return data[slot];
+        }
+
+        ValType* value = new (data + slot) ValType(std::forward<Args>(args)...);
+        ++m_size;
+        return *value;
+    }
+}
+
+template <typename ValType, std::size_t Capacity>
+void cads::CircularBuffer<ValType, Capacity>::popFront()
+{
+    assert(!empty() && "CircularBuffer::popFront: buffer is empty");
+
+    _data()[m_head].~ValType();
+    m_head = _wrap(m_head + 1);
+    --m_size;
+}
+
+template <typename ValType, std::size_t Capacity>
+void cads::CircularBuffer<ValType, Capacity>::popBack()
+{
+    assert(!empty() && "CircularBuffer::popBack: buffer is empty");
+
+    back().~ValType();
+    --m_size;
+}
+
+template <typename ValType, std::size_t Capacity>
+void cads::CircularBuffer<ValType, Capacity>::clear() noexcept
+{
+    if constexpr (!std::is_trivially_destructible_v<ValType>)
+    {
+        for (size_type i = 0; i < m_size; ++i)
+            (*this)[i].~ValType();
+    }
+
+    m_head = 0;
+    m_size = 0;
+}
+
+// -- Private methods --
+template <typename ValType, std::size_t Capacity>
+ValType* cads::CircularBuffer<ValType, Capacity>::_data() noexcept
+{
+    if constexpr (IsDynamic)
+        return m_storage.data;
+    else
+        return reinterpret_cast<ValType*>(m_storage.bytes);
+}
+
+template <typename ValType, std::size_t Capacity>
+const ValType* cads::CircularBuffer<ValType, Capacity>::_data() const noexcept
+{
+    if constexpr (IsDynamic)
+        return m_storage.data;
+    else
+        return reinterpret_cast<const ValType*>(m_storage.bytes);
+}
+
+template <typename ValType, std::size_t Capacity>
+typename cads::CircularBuffer<ValType, Capacity>::size_type cads::CircularBuffer<ValType, Capacity>::_wrap(const size_type index) const noexcept
+{
+    if constexpr (!IsDynamic && (Capacity & (Capacity - 1)) == 0)
+        return index & (Capacity - 1);
+    else
+        return index >= capacity() ? index - capacity() : index;
+}
+
+// Expects `*this` empty (and, for heap storage, without a buffer)
+template <typename ValType, std::size_t Capacity>
+void cads::CircularBuffer<ValType, Capacity>::_moveFrom(CircularBuffer& other)
+{
+    if constexpr (IsDynamic)
+    {
+        m_storage = std::exchange(other.m_storage, HeapStorage{});
+        m_head = std::exchange(other.m_head, 0);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    else
+    {
+        for (ValType& value : other)
+        {
+            new (_data() + m_size) ValType(std::move(value));
+            ++m_size;
+        }
+        other.clear();
+    }
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "cads/detail/tagged_pointer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <optional>
+#include <utility>
+
+namespace cads
+{
+
+// Lock-free Treiber stack for any number of producer and consumer threads.
+// The head carries a modification tag against ABA, and popped nodes are recycled through
+// an internal free list instead of being deleted, so a racing pop never reads freed memory.
+// Node memory is returned to the system when the stack is destroyed.
+template<typename ValType>
+class ConcurrentStack
+{
+public:
+    using value_type      = ValType;
+    using size_type       = std::size_t;
+    using reference       = ValType&;
+    using const_reference = const ValType&;
+
+    ConcurrentStack() = default;
+
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+    // Must not race with any other member call
+    ~ConcurrentStack()
+    {
+        Node* node = m_head.load().ptr;
+        while (node != nullptr)
+        {
+            Node* next = node->next.load(std::memory_order_relaxed);
+            node->value()->~ValType();
+            delete node;
+            node = next;
+        }
+
+        node = m_freeNodes.load().ptr;
+        while (node != nullptr)
+        {
+            Node* next = node->next.load(std::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+
+
+    // Snapshot, may be stale by the time it returns
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_head.load().ptr == nullptr;
+    }
+
+
+    void push(const ValType& val)
+    {
+        emplace(val);
+    }
+
+    void push(ValType&& val)
+    {
+        emplace(std::move(val));
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args)
+    {
+        Node* node = _popNode(m_freeNodes);
+        if (node == nullptr)
+            node = new Node;
+
+        try
+        {
+            new (node->storage) ValType(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            _pushChain(m_freeNodes, node, node);
+            throw;
+        }
+
+        _pushChain(m_head, node, node);
+    }
+
+
+    std::optional<ValType> tryPop()
+    {
+        Node* node = _popNode(m_head);
+        if (node == nullptr)
+            return std::nullopt;
+
+        std::optional<ValType> result{std::move(*node->value())};
+        node->value()->~ValType();
+        _pushChain(m_freeNodes, node, node);
+
+        return result;
+    }
+
+    // Detaches the whole stack with one CAS, then hands every element to `consume`
+    // (newest first) without further contention. Returns the number of elements.
+    template<typename Consume>
+    size_t popAll(Consume&& consume)
+    {
+        detail::TaggedPtr<Node> head = m_head.load();
+        while (head.ptr != nullptr && !m_head.compareExchange(head, {nullptr, head.tag + 1}))
+        { }
+
+        if (head.ptr == nullptr)
+            return 0;
+
+        size_t count = 0;
+        Node* last = nullptr;
+        for (Node* node = head.ptr; node != nullptr; node = node->next.load(std::memory_order_relaxed))
+        {
+            consume(std::move(*node->value()));
+            node->value()->~ValType();
+
+            last = node;
+            ++count;
+        }
+
+        _pushChain(m_freeNodes, head.ptr, last);
+        return count;
+    }
+
+private:
+    struct Node
+    {
+        // Atomic because a losing pop may still read it while the winner recycles the node
+        std::atomic<Node*> next{nullptr};
+        alignas(ValType) unsigned char storage[sizeof(ValType)];
+
+        ValType* value() noexcept { return std::launder(reinterpret_cast<ValType*>(storage)); }
+    };
+
+    detail::AtomicTaggedPtr<Node> m_head;
+    detail::AtomicTaggedPtr<Node> m_freeNodes;
+
+    static void _pushChain(detail::AtomicTaggedPtr<Node>& list, Node* first, Node* last)
+    {
+        detail::TaggedPtr<Node> head = list.load();
+        do
+        {
+            last->next.store(head.ptr, std::memory_order_relaxed);
+        }
+        while (!list.compareExchange(head, {first, head.tag + 1}));
+    }
+
+    static Node* _popNode(detail::AtomicTaggedPtr<Node>& list)
+    {
+        detail::TaggedPtr<Node> head = list.load();
+        while (head.ptr != nullptr)
+        {
+            Node* next = head.ptr->next.load(std::memory_order_relaxed);
+            if (list.compareExchange(head, {next, head.tag + 1}))
+                return head.ptr;
+        }
+        return nullptr;
+    }
+};
+
+} // namespace cads
@@ -0,0 +1,233 @@
+#pragma once
+
+#include "cads/detail/segment_index.h"
+#include "cads/vector.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace cads
+{
+
+// Append-only vector for many producer threads. pushBack()/growBy() claim slots with one
+// atomic fetch-add and return the index; storage is a table of doubling segments
+// (see SegmentedVector), so no element ever moves and nobody waits for a reallocation.
+// An element may be read by any thread once its index has been handed over with the
+// usual happens-before (e.g. after the appending thread was joined, or the index was
+// passed through a release/acquire pair). size() counts claimed slots, some of which may
+// still be under construction. clear(), toVector() and destruction must not race with appends.
+template<typename ValType, std::size_t BaseSize = 16>
+class ConcurrentVector
+{
+    static_assert(std::is_nothrow_move_constructible_v<ValType>,
+                  "ConcurrentVector places values into claimed slots by moving them");
+
+    using Segments = detail::SegmentIndex<BaseSize>;
+
+public:
+    using value_type      = ValType;
+    using size_type       = std::size_t;
+    using reference       = ValType&;
+    using const_reference = const ValType&;
+
+    ConcurrentVector() = default;
+
+    ConcurrentVector(const ConcurrentVector&) = delete;
+    ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+
+    ~ConcurrentVector()
+    {
+        clear();
+        for (auto& segment : m_segments)
+            operator delete(segment.load(std::memory_order_relaxed));
+    }
+
+
+    // - Access -
+    ValType& operator[](const size_type index)
+    {
+        const auto [segment, offset] = Segments::locate(index);
+        return m_segments[segment].load(std::memory_order_acquire)[offset];
+    }
+
+    const ValType& operator[](const size_type index) const
+    {
+        const auto [segment, offset] = Segments::locate(index);
+        return m_segments[segment].load(std::memory_order_acquire)[offset];
+    }
+
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return m_size.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+
+    // - Appending (thread-safe) -
+    size_type pushBack(const ValType& value)
+    {
+        return emplaceBack(value);
+    }
+
+    size_type pushBack(ValType&& value)
+    {
+        return emplaceBack(std::move(value));
+    }
+
+    // Returns the index of the new element
+    template<typename... Args>
+    size_type emplaceBack(Args&&... args)
+    {
+        if constexpr (std::is_nothrow_constructible_v<ValType, Args&&...>)
+        {
+            const size_type index = m_size.fetch_add(1, std::memory_order_relaxed);
+            new (_slot(index)) ValType(std::forward<Args>(args)...);
+            return index;
+        }
+        else
+        {
+            // Build before claiming, so a throwing constructor never leaves a hole
+            ValType value(std::forward<Args>(args)...);
+
+            const size_type index = m_size.fetch_add(1, std::memory_order_relaxed);
+            new (_slot(index)) ValType(std::move(value));
+            return index;
+        }
+    }
+
+    // Appends `count` copies of `value` as one contiguous index range; returns its first index
+    size_type growBy(const size_type count, const ValType& value = ValType{})
+    {
+        if (count == 0)
+            return m_size.load(std::memory_order_relaxed);
+
+        if constexpr (std::is_nothrow_copy_constructible_v<ValType>)
+        {
+            const size_type first = m_size.fetch_add(count, std::memory_order_relaxed);
+            _fill(first, count, [&value](ValType* slot, size_type) { new (slot) ValType(value); });
+            return first;
+        }
+        else
+        {
+            Vector<ValType> copies;
+            copies.reserve(count);
+            for (size_type i = 0; i < count; ++i)
+                copies.pushBack(value);
+
+            const size_type first = m_size.fetch_add(count, std::memory_order_relaxed);
+            _fill(first, count, [&copies](ValType* slot, size_type i) { new (slot) ValType(std::move(copies[i])); });
+            return first;
+        }
+    }
+
+
+    // - Phase boundary (not thread-safe) -
+    [[nodiscard]] Vector<ValType> toVector() const &
+    {
+        Vector<ValType> result;
+        result.reserve(size());
+        _forEachSegment([&result](ValType* segment, size_type count) {
+            for (size_type i = 0; i < count; ++i)
+                result.pushBack(segment[i]);
+        });
+        return result;
+    }
+
+    // Moves the elements out and leaves the vector empty (segments are kept)
+    [[nodiscard]] Vector<ValType> toVector() &&
+    {
+        Vector<ValType> result;
+        result.reserve(size());
+        _forEachSegment([&result](ValType* segment, size_type count) {
+            for (size_type i = 0; i < count; ++i)
+                result.pushBack(std::move(segment[i]));
+        });
+
+        clear();
+        return result;
+    }
+
+    void clear() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<ValType>)
+        {
+            _forEachSegment([](ValType* segment, size_type count) {
+                for (size_type i = 0; i < count; ++i)
+                    segment[i].~ValType();
+            });
+        }
+
+        m_size.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    alignas(64) std::atomic<size_type> m_size{0};
+    alignas(64) std::atomic<ValType*> m_segments[Segments::MaxSegments] = {};
+
+    // Past the fetch-add there is no way to give the slot back, so running out of memory
+    // here terminates instead of leaving an unconstructed element behind
+    ValType* _slot(const size_type index) noexcept
+    {
+        const auto [segment, offset] = Segments::locate(index);
+        return _segment(segment) + offset;
+    }
+
+    ValType* _segment(const size_type segment) noexcept
+    {
+        ValType* current = m_segments[segment].load(std::memory_order_acquire);
+        if (current != nullptr)
+            return current;
+
+        // Racing threads may each allocate; one CAS wins and the losers free their copy
+        auto* fresh = static_cast<ValType*>(operator new(Segments::capacityOf(segment) * sizeof(ValType)));
+        if (m_segments[segment].compare_exchange_strong(current, fresh,
+                                                        std::memory_order_acq_rel,
+                                                        std::memory_order_acquire))
+        {
+            return fresh;
+        }
+
+        operator delete(fresh);
+        return current;
+    }
+
+    template<typename Construct>
+    void _fill(const size_type first, const size_type count, Construct&& construct) noexcept
+    {
+        size_type index = first;
+        const size_type last = first + count;
+        while (index < last)
+        {
+            const auto [segment, offset] = Segments::locate(index);
+            ValType* base = _segment(segment);
+
+            const size_type run = std::min(Segments::capacityOf(segment) - offset, last - index);
+            for (size_type i = 0; i < run; ++i)
+                construct(base + offset + i, index - first + i);
+
+            index += run;
+        }
+    }
+
+    template<typename Fn>
+    void _forEachSegment(Fn&& fn) const
+    {
+        const size_type total = m_size.load(std::memory_order_acquire);
+        for (size_type segment = 0; Segments::startOf(segment) < total; ++segment)
+        {
+            const size_type count = std::min(Segments::capacityOf(segment), total - Segments::startOf(segment));
+            fn(m_segments[segment].load(std::memory_order_acquire), count);
+        }
+    }
+};
+
+} // namespace cads
@@ -0,0 +1,205 @@
+#pragma once
+
+#include "cads/blocking_queue.h"
+#include "cads/list.h"
+#include "cads/vector.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace cads
+{
+
+// Moves the destruction of large containers off the caller's thread. Containers hand over
+// their storage in O(1) (releaseTo(), clearDeferred() below) and a background thread runs
+// the destructors and frees the memory. The queue is bounded: once `maxPending` jobs are
+// waiting, further work is reclaimed inline on the caller, so a burst cannot pile up
+// unbounded garbage. The destructor finishes everything still queued.
+class DeferredReclaimer
+{
+public:
+    // Destroys `count` objects owned by `object` and frees them; must not throw
+    using ReclaimFn = void (*)(void* object, std::size_t count) noexcept;
+
+    struct Stats
+    {
+        std::size_t deferred;         // Handed to the background thread
+        std::size_t reclaimed;        // Finished by the background thread
+        std::size_t reclaimedInline;  // Queue full or closed, done on the caller
+
+        [[nodiscard]] std::size_t pending() const noexcept { return deferred - reclaimed; }
+    };
+
+    static constexpr std::size_t DefaultMaxPending = 1024;
+
+    // 0 means unbounded, as for BlockingQueue
+    explicit DeferredReclaimer(const std::size_t maxPending = DefaultMaxPending)
+        : m_queue{maxPending}
+        , m_thread{[this] { _run(); }}
+    { }
+
+    DeferredReclaimer(const DeferredReclaimer&) = delete;
+    DeferredReclaimer& operator=(const DeferredReclaimer&) = delete;
+
+    ~DeferredReclaimer()
+    {
+        m_queue.close();
+        m_thread.join();
+    }
+
+    // Shared instance behind clearDeferred()
+    static DeferredReclaimer& global()
+    {
+        static DeferredReclaimer reclaimer;
+        return reclaimer;
+    }
+
+    void defer(void* object, const std::size_t count, const ReclaimFn reclaim) noexcept
+    {
+        // Counted up front so the worker can never finish a job that is not yet counted
+        m_deferred.fetch_add(1, std::memory_order_relaxed);
+
+        bool queued = false;
+        try
+        {
+            queued = m_queue.tryPush(Job{object, count, reclaim});
+        }
+        catch (...)
+        { }
+
+        if (queued)
+            return;
+
+        {
+            std::lock_guard lock{m_idleMutex};
+            m_deferred.fetch_sub(1, std::memory_order_relaxed);
+        }
+        m_idle.notify_all();
+
+        reclaim(object, count);
+        m_reclaimedInline.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Blocks until everything deferred so far has been reclaimed
+    void waitIdle()
+    {
+        std::unique_lock lock{m_idleMutex};
+        m_idle.wait(lock, [this] {
+            return m_reclaimed >= m_deferred.load(std::memory_order_relaxed);
+        });
+    }
+
+    [[nodiscard]] Stats stats() const
+    {
+        std::lock_guard lock{m_idleMutex};
+        return Stats{
+            m_deferred.load(std::memory_order_relaxed),
+            m_reclaimed,
+            m_reclaimedInline.load(std::memory_order_relaxed),
+        };
+    }
+
+private:
+    struct Job
+    {
+        void* object;
+        std::size_t count;
+        ReclaimFn reclaim;
+    };
+
+    BlockingQueue<Job> m_queue;
+
+    std::atomic<std::size_t> m_deferred{0};
+    std::atomic<std::size_t> m_reclaimedInline{0};
+
+    mutable std::mutex m_idleMutex;
+    std::condition_variable m_idle;
+    std::size_t m_reclaimed = 0;  // Guarded by m_idleMutex
+
+    // Declared last so the worker starts after every other member is initialised
+    std::thread m_thread;
+
+    void _run()
+    {
+        while (std::optional<Job> job = m_queue.pop())
+        {
+            job->reclaim(job->object, job->count);
+
+            {
+                std::lock_guard lock{m_idleMutex};
+                ++m_reclaimed;
+            }
+            m_idle.notify_all();
+        }
+    }
+};
+
+namespace detail
+{
+
+// Moves `container` into a heap object the reclaimer deletes; if even that small allocation
+// fails, the contents are destroyed inline instead
+template<typename Container>
+void deferDestruction(Container& container, DeferredReclaimer& reclaimer) noexcept
+{
+    Container* doomed = nullptr;
+    try
+    {
+        doomed = new Container(std::move(container));
+    }
+    catch (...)
+    {
+        container.clear();
+        return;
+    }
+
+    reclaimer.defer(doomed, 1, [](void* object, std::size_t) noexcept {
+        delete static_cast<Container*>(object);
+    });
+}
+
+} // namespace detail
+
+// O(1): hands the elements and the buffer to `reclaimer`, leaving `vec` empty with no
+// capacity. Trivially destructible elements need no destructor calls, so their buffer is
+// freed right away instead of being queued.
+template<typename ValType>
+void releaseTo(Vector<ValType>& vec, DeferredReclaimer& reclaimer) noexcept
+{
+    if (vec.capacity() == 0)
+        return;
+
+    if constexpr (std::is_trivially_destructible_v<ValType>)
+        Vector<ValType>{std::move(vec)};
+    else
+        detail::deferDestruction(vec, reclaimer);
+}
+
+// O(1): hands the nodes to `reclaimer`, leaving `list` empty
+template<typename ValType>
+void releaseTo(List<ValType>& list, DeferredReclaimer& reclaimer) noexcept
+{
+    if (!list.empty())
+        detail::deferDestruction(list, reclaimer);
+}
+
+// releaseTo() the shared DeferredReclaimer::global()
+template<typename ValType>
+void clearDeferred(Vector<ValType>& vec) noexcept
+{
+    releaseTo(vec, DeferredReclaimer::global());
+}
+
+template<typename ValType>
+void clearDeferred(List<ValType>& list) noexcept
+{
+    releaseTo(list, DeferredReclaimer::global());
+}
+
+} // namespace cads
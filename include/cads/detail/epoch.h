@@ -0,0 +1,203 @@
+#pragma once
+
+#include "cads/vector.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace cads::detail
+{
+
+// Process-wide epoch-based reclamation. Readers pin the current epoch for the duration of a
+// critical section, which costs a load and a store on a thread-private cache line, no loops.
+// Writers retire() objects they have unlinked; an object retired in epoch e is freed once
+// the global epoch reaches e + 2, as by then every reader that could have seen it has left.
+// The epoch only advances when no pinned reader is behind it, so a reader that never unpins
+// delays reclamation but never makes it unsafe.
+class EpochDomain
+{
+    struct alignas(64) Record
+    {
+        std::atomic<std::uint64_t> state{0};  // (epoch << 1) | 1 while pinned, 0 otherwise
+        std::atomic<bool> inUse{true};
+        std::size_t depth = 0;                // Nested pins, touched only by the owning thread
+        Record* next = nullptr;
+    };
+
+public:
+    // Pins the calling thread's record; nests, and must be released on the same thread
+    class Guard
+    {
+    public:
+        explicit Guard(EpochDomain& domain) noexcept
+            : m_record{domain._localRecord()}
+        {
+            if (m_record->depth++ == 0)
+            {
+                m_record->state.store((domain.m_epoch.load(std::memory_order_relaxed) << 1) | 1,
+                                      std::memory_order_relaxed);
+                // The announcement must be visible before this thread loads any shared pointer
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        ~Guard()
+        {
+            if (--m_record->depth == 0)
+                m_record->state.store(0, std::memory_order_release);
+        }
+
+    private:
+        Record* m_record;
+    };
+
+    static EpochDomain& global()
+    {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    ~EpochDomain()
+    {
+        for (const Retired& retired : m_retired)
+            retired.deleter(retired.object);
+
+        for (Record* record = m_records.load(std::memory_order_relaxed); record != nullptr;)
+        {
+            Record* next = record->next;
+            delete record;
+            record = next;
+        }
+    }
+
+    // Frees `object` with `deleter` once no pinned reader can still reach it
+    void retire(void* object, void (*deleter)(void*))
+    {
+        // Pairs with the fence in Guard: a reader not yet announced will not see `object`
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        const std::lock_guard lock{m_retireMutex};
+        m_retired.pushBack(Retired{object, deleter, m_epoch.load(std::memory_order_relaxed)});
+        _collect();
+    }
+
+    template<typename T>
+    void retire(T* object)
+    {
+        retire(object, [](void* ptr) { delete static_cast<T*>(ptr); });
+    }
+
+    // Advances as far as the pinned readers allow and frees what has become safe
+    void collect()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        const std::lock_guard lock{m_retireMutex};
+        _collect();
+        _collect();
+    }
+
+    [[nodiscard]] std::size_t pendingCount()
+    {
+        const std::lock_guard lock{m_retireMutex};
+        return m_retired.size();
+    }
+
+private:
+    struct Retired
+    {
+        void* object;
+        void (*deleter)(void*);
+        std::uint64_t epoch;
+    };
+
+    // Returns the record to the pool when its thread exits
+    struct LocalRecord
+    {
+        Record* record = nullptr;
+
+        ~LocalRecord()
+        {
+            if (record != nullptr)
+            {
+                record->state.store(0, std::memory_order_release);
+                record->inUse.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    std::atomic<std::uint64_t> m_epoch{0};
+    std::atomic<Record*> m_records{nullptr};
+
+    std::mutex m_retireMutex;
+    Vector<Retired> m_retired;
+
+    EpochDomain() = default;
+
+    Record* _localRecord()
+    {
+        thread_local LocalRecord local;
+        if (local.record == nullptr)
+            local.record = _acquireRecord();
+        return local.record;
+    }
+
+    // Reuses a record left behind by an exited thread, else publishes a new one
+    Record* _acquireRecord()
+    {
+        for (Record* record = m_records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+        {
+            bool free = false;
+            if (!record->inUse.load(std::memory_order_relaxed) &&
+                record->inUse.compare_exchange_strong(free, true, std::memory_order_acquire))
+            {
+                return record;
+            }
+        }
+
+        auto* record = new Record;
+        record->next = m_records.load(std::memory_order_relaxed);
+        while (!m_records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed))
+        { }
+        return record;
+    }
+
+    // Caller holds m_retireMutex
+    void _collect()
+    {
+        const std::uint64_t epoch = m_epoch.load(std::memory_order_relaxed);
+
+        bool canAdvance = true;
+        for (Record* record = m_records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+        {
+            const std::uint64_t state = record->state.load(std::memory_order_acquire);
+            if ((state & 1) != 0 && (state >> 1) != epoch)
+            {
+                canAdvance = false;
+                break;
+            }
+        }
+
+        const std::uint64_t current = canAdvance ? epoch + 1 : epoch;
+        if (canAdvance)
+            m_epoch.store(current, std::memory_order_relaxed);
+
+        m_retired.eraseIf([current](const Retired& retired) {
+            if (retired.epoch + 2 > current)
+                return false;
+
+            retired.deleter(retired.object);
+            return true;
+        });
+    }
+};
+
+} // namespace cads::detail
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace cads::detail
+{
+
+// One allocation holding `capacity` nodes back to back. Nodes remember their slab and the
+// slab counts the ones still alive, so a node can be released on its own, after being moved
+// to another container, or from another thread; the memory goes away with the last node.
+// Slots are counted only once constructed, so a partially filled slab is fine.
+template<typename NodeType>
+class NodeSlab
+{
+public:
+    // Fresh slab with room for `capacity` nodes and none alive yet
+    static NodeSlab* create(const std::size_t capacity)
+    {
+        void* memory = operator new(NodesOffset + capacity * sizeof(NodeType), std::align_val_t{Alignment});
+        return new (memory) NodeSlab{};
+    }
+
+    // Frees a slab in which no node was ever constructed
+    static void destroyEmpty(NodeSlab* slab) noexcept
+    {
+        slab->~NodeSlab();
+        operator delete(slab, std::align_val_t{Alignment});
+    }
+
+    NodeType* slot(const std::size_t index) noexcept
+    {
+        auto* nodes = reinterpret_cast<NodeType*>(reinterpret_cast<std::byte*>(this) + NodesOffset);
+        return nodes + index;
+    }
+
+    // Called once per node constructed in a slot
+    void acquire() noexcept
+    {
+        m_live.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Called once per node destroyed; the last one frees the slab
+    void release() noexcept
+    {
+        if (m_live.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            destroyEmpty(this);
+    }
+
+private:
+    static constexpr std::size_t Alignment = std::max(alignof(NodeType), alignof(std::atomic<std::size_t>));
+    static constexpr std::size_t NodesOffset =
+        (sizeof(std::atomic<std::size_t>) + alignof(NodeType) - 1) / alignof(NodeType) * alignof(NodeType);
+
+    std::atomic<std::size_t> m_live{0};
+
+    NodeSlab() = default;
+};
+
+} // namespace cads::detail
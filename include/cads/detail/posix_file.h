@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <unistd.h>
+
+namespace cads::detail
+{
+
+// Turns the current errno into a std::system_error whose what() starts with `what`
+[[noreturn]] inline void throwErrno(const char* what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+// Owning POSIX file descriptor, closed on destruction
+class FileDescriptor
+{
+public:
+    FileDescriptor() noexcept = default;
+
+    explicit FileDescriptor(const int fd) noexcept
+        : m_fd{fd}
+    { }
+
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+    FileDescriptor(FileDescriptor&& other) noexcept
+        : m_fd{std::exchange(other.m_fd, -1)}
+    { }
+
+    FileDescriptor& operator=(FileDescriptor&& other) noexcept
+    {
+        if (this != &other)
+            reset(std::exchange(other.m_fd, -1));
+        return *this;
+    }
+
+    ~FileDescriptor()
+    {
+        reset();
+    }
+
+    [[nodiscard]] int get() const noexcept
+    {
+        return m_fd;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return m_fd >= 0;
+    }
+
+    void reset(const int fd = -1) noexcept
+    {
+        if (m_fd >= 0)
+            ::close(m_fd);
+        m_fd = fd;
+    }
+
+private:
+    int m_fd = -1;
+};
+
+} // namespace cads::detail
@@ -0,0 +1,17 @@
+#pragma once
+
+namespace cads::detail
+{
+
+// Hint the CPU to pull the cache line holding `address` into cache.
+// Compiles to nothing on compilers without the builtin.
+inline void prefetch(const void* address) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
+} // namespace cads::detail
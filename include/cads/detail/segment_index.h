@@ -0,0 +1,50 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+
+namespace cads::detail
+{
+
+// Index math for containers made of power-of-two segments that double in size:
+// segment k holds BaseSize << k elements and starts at element BaseSize * (2^k - 1).
+// A 64-entry segment table therefore covers every size_t index.
+template<std::size_t BaseSize>
+struct SegmentIndex
+{
+    static_assert(std::has_single_bit(BaseSize), "BaseSize must be a power of two");
+
+    static constexpr std::size_t MaxSegments = 64;
+    static constexpr int BaseShift = std::countr_zero(BaseSize);
+
+    struct Position
+    {
+        std::size_t segment;
+        std::size_t offset;
+    };
+
+    static constexpr std::size_t capacityOf(const std::size_t segment) noexcept
+    {
+        return BaseSize << segment;
+    }
+
+    static constexpr std::size_t startOf(const std::size_t segment) noexcept
+    {
+        return (BaseSize << segment) - BaseSize;
+    }
+
+    // One shift and one bit scan, no loop
+    static constexpr Position locate(const std::size_t index) noexcept
+    {
+        const std::size_t segment = std::bit_width((index >> BaseShift) + 1) - 1;
+        return {segment, index - startOf(segment)};
+    }
+
+    // Number of segments needed to hold `count` elements
+    static constexpr std::size_t segmentsFor(const std::size_t count) noexcept
+    {
+        return count == 0 ? 0 : locate(count - 1).segment + 1;
+    }
+};
+
+} // namespace cads::detail
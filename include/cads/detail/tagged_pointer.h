@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+
+namespace cads::detail
+{
+
+template<typename T>
+struct TaggedPtr
+{
+    T* ptr;
+    uintptr_t tag;
+};
+
+// Pointer plus modification counter updated with a single CAS, the usual ABA guard.
+// Uses a 16-byte CAS (cmpxchg16b) when the compiler is allowed to emit it (-mcx16, which the
+// cads CMake target adds on x86-64), otherwise packs a 16-bit tag into the unused top bits of
+// a 64-bit pointer (32/32 on 32-bit targets). The packed tag wraps after 65536 updates: a
+// thread stalled between its load and its CAS while exactly that many updates go by can
+// still hit ABA, and AtomicPersistentVector, which counts pending readers in the tag, then
+// supports at most 65535 readers inside load() at once.
+template<typename T>
+class AtomicTaggedPtr
+{
+public:
+    AtomicTaggedPtr() noexcept
+        : m_value{0}
+    { }
+
+    AtomicTaggedPtr(const AtomicTaggedPtr&) = delete;
+    AtomicTaggedPtr& operator=(const AtomicTaggedPtr&) = delete;
+
+    TaggedPtr<T> load() const noexcept
+    {
+#if defined(__x86_64__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+        // cmpxchg16b is the only 16-byte atomic read, comparing against 0 never changes the value
+        return _unpack(__sync_val_compare_and_swap(&m_value, Word{0}, Word{0}));
+#else
+        return _unpack(m_value.load(std::memory_order_acquire));
+#endif
+    }
+
+    // On failure `expected` is refreshed with the current value
+    bool compareExchange(TaggedPtr<T>& expected, const TaggedPtr<T> desired) noexcept
+    {
+        Word current = _pack(expected);
+#if defined(__x86_64__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+        const Word previous = __sync_val_compare_and_swap(&m_value, current, _pack(desired));
+        if (previous == current)
+            return true;
+
+        expected = _unpack(previous);
+        return false;
+#else
+        if (m_value.compare_exchange_weak(current, _pack(desired),
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire))
+        {
+            return true;
+        }
+
+        expected = _unpack(current);
+        return false;
+#endif
+    }
+
+private:
+#if defined(__x86_64__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+    using Word = unsigned __int128;
+    static constexpr int PointerBits = 64;
+
+    alignas(16) mutable Word m_value;
+#else
+    using Word = uint64_t;
+    static constexpr int PointerBits = sizeof(void*) == 8 ? 48 : 32;
+
+    std::atomic<Word> m_value;
+#endif
+
+    static constexpr Word PointerMask = PointerBits == 64 ? Word{~uint64_t{0}} : (Word{1} << PointerBits) - 1;
+
+    static Word _pack(const TaggedPtr<T>& value) noexcept
+    {
+        const auto address = static_cast<Word>(reinterpret_cast<uintptr_t>(value.ptr));
+        assert((address & ~PointerMask) == 0 && "pointer does not fit into the tagged representation");
+
+        return address | (static_cast<Word>(value.tag) << PointerBits);
+    }
+
+    static TaggedPtr<T> _unpack(const Word word) noexcept
+    {
+        return TaggedPtr<T>{
+            reinterpret_cast<T*>(static_cast<uintptr_t>(word & PointerMask)),
+            static_cast<uintptr_t>(word >> PointerBits)
+        };
+    }
+};
+
+} // namespace cads::detail
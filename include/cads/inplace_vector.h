@@ -0,0 +1,366 @@
+#pragma once
+
+#include "cads/vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace cads
+{
+
+namespace detail
+{
+
+// Smallest unsigned type able to count up to `Max`
+template<std::size_t Max>
+using SmallestSizeType = std::conditional_t<Max <= UINT8_MAX, std::uint8_t,
+                         std::conditional_t<Max <= UINT16_MAX, std::uint16_t,
+                         std::conditional_t<Max <= UINT32_MAX, std::uint32_t, std::size_t>>>;
+
+} // namespace detail
+
+// Vector with room for exactly `Capacity` elements stored inside the object itself: it
+// never allocates, and the only bookkeeping is a size counter of the smallest sufficient
+// width. Copy, move and destruction are trivial whenever they are for ValType, so an
+// InplaceVector of a trivially copyable type is trivially copyable too.
+// Overflowing pushBack()/insert() throw std::length_error; tryPushBack() reports it instead.
+template<typename ValType, std::size_t Capacity>
+class InplaceVector
+{
+    using SizeType = detail::SmallestSizeType<Capacity>;
+
+public:
+    // Same iterator types as Vector: both are thin wrappers over a contiguous array
+    using Iterator             = typename Vector<ValType>::Iterator;
+    using ConstIterator        = typename Vector<ValType>::ConstIterator;
+    using ReverseIterator      = std::reverse_iterator<Iterator>;
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+    using value_type      = ValType;
+    using size_type       = std::size_t;
+    using reference       = ValType&;
+    using const_reference = const ValType&;
+    using pointer         = ValType*;
+    using const_pointer   = const ValType*;
+    using iterator        = Iterator;
+    using const_iterator  = ConstIterator;
+
+    // -- Constructors --
+    InplaceVector() noexcept
+        : m_size{0}
+    { }
+
+    explicit InplaceVector(const size_type size, const ValType& value = ValType{})
+        : m_size{0}
+    {
+        resize(size, value);
+    }
+
+    InplaceVector(std::initializer_list<ValType> list)
+        : m_size{0}
+    {
+        _checkCapacity(list.size(), "InplaceVector: initializer list exceeds capacity");
+        for (const ValType& value : list)
+            _constructBack(value);
+    }
+
+    InplaceVector(const InplaceVector&) requires std::is_trivially_copy_constructible_v<ValType> = default;
+    InplaceVector(const InplaceVector& other)
+        : m_size{0}
+    {
+        for (const ValType& value : other)
+            _constructBack(value);
+    }
+
+    InplaceVector(InplaceVector&&) requires std::is_trivially_move_constructible_v<ValType> = default;
+    InplaceVector(InplaceVector&& other) noexcept(std::is_nothrow_move_constructible_v<ValType>)
+        : m_size{0}
+    {
+        for (ValType& value : other)
+            _constructBack(std::move(value));
+    }
+
+    InplaceVector& operator=(const InplaceVector&)
+        requires (std::is_trivially_copy_assignable_v<ValType> &&
+                  std::is_trivially_copy_constructible_v<ValType> &&
+                  std::is_trivially_destructible_v<ValType>) = default;
+    InplaceVector& operator=(const InplaceVector& other)
+    {
+        if (this != &other)
+            _assign(other.begin(), other.end(), [](const ValType& value) -> const ValType& { return value; });
+        return *this;
+    }
+
+    InplaceVector& operator=(InplaceVector&&)
+        requires (std::is_trivially_move_assignable_v<ValType> &&
+                  std::is_trivially_move_constructible_v<ValType> &&
+                  std::is_trivially_destructible_v<ValType>) = default;
+    InplaceVector& operator=(InplaceVector&& other) noexcept(std::is_nothrow_move_assignable_v<ValType> &&
+                                                            std::is_nothrow_move_constructible_v<ValType>)
+    {
+        if (this != &other)
+            _assign(other.begin(), other.end(), [](ValType& value) -> ValType&& { return std::move(value); });
+        return *this;
+    }
+
+    // -- Destructor --
+    ~InplaceVector() requires std::is_trivially_destructible_v<ValType> = default;
+    ~InplaceVector()
+    {
+        clear();
+    }
+
+    // -- Methods --
+    // - Access -
+    ValType& operator[](const size_type index) { return data()[index]; }
+    const ValType& operator[](const size_type index) const { return data()[index]; }
+
+    ValType& at(const size_type index)
+    {
+        if (index >= m_size)
+            throw std::out_of_range("InplaceVector::at: index out of range");
+        return data()[index];
+    }
+
+    const ValType& at(const size_type index) const
+    {
+        if (index >= m_size)
+            throw std::out_of_range("InplaceVector::at: index out of range");
+        return data()[index];
+    }
+
+    ValType& front()
+    {
+        assert(!empty() && "InplaceVector::front: vector is empty");
+        return data()[0];
+    }
+
+    const ValType& front() const
+    {
+        assert(!empty() && "InplaceVector::front: vector is empty");
+        return data()[0];
+    }
+
+    ValType& back()
+    {
+        assert(!empty() && "InplaceVector::back: vector is empty");
+        return data()[m_size - 1];
+    }
+
+    const ValType& back() const
+    {
+        assert(!empty() && "InplaceVector::back: vector is empty");
+        return data()[m_size - 1];
+    }
+
+    ValType* data() noexcept { return reinterpret_cast<ValType*>(m_storage); }
+    const ValType* data() const noexcept { return reinterpret_cast<const ValType*>(m_storage); }
+
+    // - Iterator methods -
+    Iterator begin() noexcept { return Iterator(data()); }
+    ConstIterator begin() const noexcept { return ConstIterator(data()); }
+    Iterator end() noexcept { return Iterator(data() + m_size); }
+    ConstIterator end() const noexcept { return ConstIterator(data() + m_size); }
+
+    ConstIterator cbegin() const noexcept { return begin(); }
+    ConstIterator cend() const noexcept { return end(); }
+
+    ReverseIterator rbegin() noexcept { return ReverseIterator(end()); }
+    ConstReverseIterator rbegin() const noexcept { return ConstReverseIterator(end()); }
+    ReverseIterator rend() noexcept { return ReverseIterator(begin()); }
+    ConstReverseIterator rend() const noexcept { return ConstReverseIterator(begin()); }
+
+    ConstReverseIterator crbegin() const noexcept { return rbegin(); }
+    ConstReverseIterator crend() const noexcept { return rend(); }
+
+    // - Capacity -
+    [[nodiscard]] size_type size() const noexcept { return m_size; }
+    [[nodiscard]] static constexpr size_type capacity() noexcept { return Capacity; }
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+    [[nodiscard]] bool full() const noexcept { return m_size == Capacity; }
+
+    // Nothing to allocate; only checks that the request fits
+    void reserve(const size_type newCapacity)
+    {
+        _checkCapacity(newCapacity, "InplaceVector::reserve: capacity exceeded");
+    }
+
+    void shrinkToFit() noexcept {}
+
+    void resize(const size_type newSize)
+    {
+        _checkCapacity(newSize, "InplaceVector::resize: capacity exceeded");
+        while (m_size > newSize)
+            popBack();
+        while (m_size < newSize)
+            _constructBack();
+    }
+
+    void resize(const size_type newSize, const ValType& value)
+    {
+        _checkCapacity(newSize, "InplaceVector::resize: capacity exceeded");
+        while (m_size > newSize)
+            popBack();
+        while (m_size < newSize)
+            _constructBack(value);
+    }
+
+    // - Modifiers -
+    Iterator insert(ConstIterator pos, const ValType& value)
+    {
+        const auto index = static_cast<size_type>(pos - cbegin());
+        _checkCapacity(m_size + 1, "InplaceVector::insert: capacity exceeded");
+
+        if (index == m_size)
+        {
+            _constructBack(value);
+            return begin() + index;
+        }
+
+        // Copy first: `value` may live in this vector
+        ValType copy(value);
+        ValType* elements = data();
+
+        _constructBack(std::move_if_noexcept(elements[m_size - 1]));
+        for (size_type i = m_size - 2; i > index; --i)
+            elements[i] = std::move_if_noexcept(elements[i - 1]);
+        elements[index] = std::move(copy);
+
+        return begin() + index;
+    }
+
+    void pushBack(const ValType& value)
+    {
+        emplaceBack(value);
+    }
+
+    void pushBack(ValType&& value)
+    {
+        emplaceBack(std::move(value));
+    }
+
+    template<typename... Args>
+    ValType& emplaceBack(Args&&... args)
+    {
+        _checkCapacity(m_size + 1, "InplaceVector::pushBack: capacity exceeded");
+        return _constructBack(std::forward<Args>(args)...);
+    }
+
+    // False, and nothing constructed, if the vector is full
+    bool tryPushBack(const ValType& value)
+    {
+        if (full())
+            return false;
+
+        _constructBack(value);
+        return true;
+    }
+
+    bool tryPushBack(ValType&& value)
+    {
+        if (full())
+            return false;
+
+        _constructBack(std::move(value));
+        return true;
+    }
+
+    void popBack()
+    {
+        assert(!empty() && "InplaceVector::popBack: vector is empty");
+
+        --m_size;
+        data()[m_size].~ValType();
+    }
+
+    void clear() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<ValType>)
+        {
+            for (size_type i = 0; i < m_size; ++i)
+                data()[i].~ValType();
+        }
+        m_size = 0;
+    }
+
+    Iterator erase(ConstIterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    Iterator erase(ConstIterator first, ConstIterator last)
+    {
+        const auto firstIndex = static_cast<size_type>(first - cbegin());
+        const auto count = static_cast<size_type>(last - first);
+
+        ValType* elements = data();
+        for (size_type i = firstIndex; i + count < m_size; ++i)
+            elements[i] = std::move(elements[i + count]);
+
+        for (size_type i = 0; i < count; ++i)
+            popBack();
+
+        return begin() + firstIndex;
+    }
+
+    void swap(InplaceVector& other) noexcept(std::is_nothrow_swappable_v<ValType> &&
+                                             std::is_nothrow_move_constructible_v<ValType>)
+    {
+        InplaceVector& shorter = m_size < other.m_size ? *this : other;
+        InplaceVector& longer = m_size < other.m_size ? other : *this;
+
+        const size_type common = shorter.m_size;
+
+        using std::swap;
+        for (size_type i = 0; i < common; ++i)
+            swap(shorter[i], longer[i]);
+
+        for (size_type i = common; i < longer.m_size; ++i)
+            shorter._constructBack(std::move(longer[i]));
+        while (longer.m_size > common)
+            longer.popBack();
+    }
+
+private:
+    alignas(ValType) unsigned char m_storage[sizeof(ValType) * (Capacity == 0 ? 1 : Capacity)];
+    SizeType m_size;
+
+    static void _checkCapacity(const size_type required, const char* message)
+    {
+        if (required > Capacity)
+            throw std::length_error(message);
+    }
+
+    template<typename... Args>
+    ValType& _constructBack(Args&&... args)
+    {
+        ValType* value = new (data() + m_size) ValType(std::forward<Args>(args)...);
+        ++m_size;
+        return *value;
+    }
+
+    // Element-wise assignment over the common prefix, then construct or destroy the rest
+    template<typename It, typename Forward>
+    void _assign(It first, It last, Forward forward)
+    {
+        const auto count = static_cast<size_type>(last - first);
+        const size_type common = count < m_size ? count : m_size;
+
+        for (size_type i = 0; i < common; ++i, ++first)
+            data()[i] = forward(*first);
+
+        for (; first != last; ++first)
+            _constructBack(forward(*first));
+        while (m_size > count)
+            popBack();
+    }
+};
+
+} // namespace cads
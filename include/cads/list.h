@@ -1,8 +1,19 @@
 #pragma once
 
+#include "cads/detail/node_slab.h"
+
+#include <algorithm>
 #include <initializer_list>
 #include <cstddef>
 #include <iterator>
+#include <new>
+#include <utility>
+
+// How many nodes the bulk List traversals (clear, remove, reverse, copy, forEach, ...) run a
+// prefetching cursor ahead of the node being processed; 0 turns prefetching off
+#ifndef CADS_LIST_PREFETCH_DISTANCE
+#define CADS_LIST_PREFETCH_DISTANCE 4
+#endif
 
 namespace cads
 {
@@ -27,6 +38,8 @@ public:
     using iterator        = Iterator;
     using const_iterator  = ConstIterator;
 
+    static constexpr size_t PrefetchDistance = CADS_LIST_PREFETCH_DISTANCE;
+
     // -- Iterators --
     class Iterator
     {
@@ -111,6 +124,8 @@ public:
     List(std::initializer_list<ValType> list);
     List(const List& other);
     List(List&& other) noexcept;
+    // Reuses the existing nodes, allocating only for the extra elements (basic guarantee);
+    // `list = List(other)` opts into the strong guarantee
     List& operator=(const List& other);
     List& operator=(List&& other) noexcept;
     List& operator=(std::initializer_list<ValType> list);
@@ -152,6 +167,11 @@ public:
 
     // - Modifiers -
     Iterator insert(ConstIterator pos, const ValType& value);
+    // Bulk forms allocate the new nodes a block at a time and link them in one step; if a
+    // copy throws nothing is inserted. Return the first inserted element, or `pos`
+    Iterator insert(ConstIterator pos, size_t count, const ValType& value);
+    template<std::input_iterator It>
+    Iterator insert(ConstIterator pos, It first, It last);
 
     void pushBack(const ValType& value);
     void pushBack(ValType&& value);
@@ -166,17 +186,41 @@ public:
     void remove(const ValType& value); // +
     void clear() noexcept;
 
+    // Replace the contents, assigning over existing nodes like copy assignment does
+    void assign(size_t count, const ValType& value);
+    template<std::input_iterator It>
+    void assign(It first, It last);
+
     void swap(List& other) noexcept;
     void reverse();
 
     void splice(ConstIterator pos, List& other, ConstIterator first, ConstIterator last);
 
+    // Calls `fn` on every element in order; faster than an iterator loop on scattered
+    // nodes because upcoming nodes are prefetched while `fn` runs
+    template<typename Fn>
+    void forEach(Fn&& fn);
+    template<typename Fn>
+    void forEach(Fn&& fn) const;
+
+    // - Layout -
+    // Moves the elements into one contiguous block in list order, so traversal walks memory
+    // sequentially again after heavy insert/erase/splice churn. Invalidates all iterators.
+    void compact();
+    // Incremental form: relays out at most `budget` nodes starting at `from` and returns
+    // where the next call should continue (end() once done). Only iterators into the
+    // relaid window are invalidated; a window that is already contiguous is left alone.
+    ConstIterator compact(ConstIterator from, size_t budget);
+
 private:
+    using Slab = detail::NodeSlab<Node>;
+
     struct Node
     {
         ValType data;
         Node* prev;
         Node* next;
+        Slab* slab = nullptr;  // Owning block, or null for a node allocated on its own
 
         Node() : data{}, prev(this), next(this) {}
 
@@ -189,10 +233,95 @@ private:
         Node(Node&&) noexcept = default;
     };
 
+    // Upper bound on one bulk allocation, so a long-lived slab cannot pin too much memory
+    static constexpr size_t MaxBatchBytes = size_t{2} << 20;
+
+    // Builds a detached chain of nodes in slabs sized from the expected count; commit()
+    // links it into the list, otherwise the destructor frees whatever was built
+    class NodeBatch
+    {
+    public:
+        explicit NodeBatch(const size_t expected) noexcept
+            : m_remaining{expected}
+        { }
+
+        NodeBatch(const NodeBatch&) = delete;
+        NodeBatch& operator=(const NodeBatch&) = delete;
+
+        ~NodeBatch()
+        {
+            if (m_slab != nullptr && m_slot == 0)
+                Slab::destroyEmpty(m_slab);
+            _prefetchingWalk(m_head, static_cast<Node*>(nullptr), [](Node* node) { _freeNode(node); });
+        }
+
+        template<typename Value>
+        void append(Value&& value)
+        {
+            if (m_slab == nullptr || m_slot == m_slabCapacity)
+            {
+                // Sized to what is still expected; past that, e.g. for input iterators, grow geometrically
+                constexpr size_t maxNodes = MaxBatchBytes / sizeof(Node) > 0 ? MaxBatchBytes / sizeof(Node) : 1;
+                const size_t wanted = m_remaining > 0 ? m_remaining : std::max<size_t>(2 * m_slabCapacity, 16);
+                m_slabCapacity = std::min(wanted, maxNodes);
+                m_slab = Slab::create(m_slabCapacity);
+                m_slot = 0;
+            }
+
+            Node* node = new (m_slab->slot(m_slot)) Node{ std::forward<Value>(value), m_tail, nullptr };
+            node->slab = m_slab;
+            m_slab->acquire();
+            ++m_slot;
+
+            if (m_tail != nullptr)
+                m_tail->next = node;
+            else
+                m_head = node;
+            m_tail = node;
+
+            ++m_count;
+            if (m_remaining > 0)
+                --m_remaining;
+        }
+
+        [[nodiscard]] size_t size() const noexcept { return m_count; }
+
+        // Links the chain in front of `pos`; returns its first node, or `pos` if empty
+        Node* commit(Node* pos) noexcept
+        {
+            if (m_head == nullptr)
+                return pos;
+
+            Node* first = std::exchange(m_head, nullptr);
+            first->prev = pos->prev;
+            pos->prev->next = first;
+            m_tail->next = pos;
+            pos->prev = m_tail;
+
+            m_tail = nullptr;
+            m_slab = nullptr;
+            return first;
+        }
+
+    private:
+        Node* m_head = nullptr;
+        Node* m_tail = nullptr;
+        Slab* m_slab = nullptr;
+        size_t m_slot = 0;
+        size_t m_slabCapacity = 0;
+        size_t m_remaining;
+        size_t m_count = 0;
+    };
+
     Node* m_sentinel;
     size_t m_size;
 
-    Node* _initWithValues(Node* currTail, const ValType& value);
+    static void _freeNode(Node* node) noexcept;
+
+    // Visits [first, last) with a second cursor PrefetchDistance nodes ahead. `visit` may
+    // relink or free the node it is given, never the ones after it.
+    template<typename NodePtr, typename Visit>
+    static void _prefetchingWalk(NodePtr first, NodePtr last, Visit visit);
 };
 
 } // namespace cads
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "cads/detail/prefetch.h"
+
 #include <cassert>
+#include <new>
 #include <utility>
 #include <iterator>
 
@@ -12,43 +15,42 @@ cads::List<ValType>::List()
     m_sentinel = new Node{};
 }
 
+// The bulk constructors build their nodes before the sentinel, so nothing leaks if a copy throws
 template <typename ValType>
 cads::List<ValType>::List(const size_t size, const ValType& value)
-    : m_size(size)
+    : m_size{size}
 {
-    m_sentinel = new Node{};
+    NodeBatch batch{size};
+    for (size_t i = 0; i < size; ++i)
+        batch.append(value);
 
-    Node* currTail = m_sentinel;
-    for (size_t i = 0; i < m_size; ++i)
-    {
-        currTail = _initWithValues(currTail, value);
-    }
+    m_sentinel = new Node{};
+    batch.commit(m_sentinel);
 }
 
 template <typename ValType>
 cads::List<ValType>::List(std::initializer_list<ValType> list)
-    : m_size(list.size())
+    : m_size{list.size()}
 {
-    m_sentinel = new Node{};
-
-    Node* currTail = m_sentinel;
+    NodeBatch batch{list.size()};
     for (const ValType& item : list)
-    {
-        currTail = _initWithValues(currTail, item);
-    }
+        batch.append(item);
+
+    m_sentinel = new Node{};
+    batch.commit(m_sentinel);
 }
 
 template <typename ValType>
 cads::List<ValType>::List(const List& other)
-    : m_size(other.m_size)
+    : m_size{other.m_size}
 {
-    m_sentinel = new Node{};
+    NodeBatch batch{other.m_size};
+    _prefetchingWalk(other.m_sentinel->next, other.m_sentinel, [&batch](const Node* node) {
+        batch.append(node->data);
+    });
 
-    Node* currTail = m_sentinel;
-    for (const ValType& item : other)
-    {
-        currTail = _initWithValues(currTail, item);
-    }
+    m_sentinel = new Node{};
+    batch.commit(m_sentinel);
 }
 
 template <typename ValType>
@@ -64,10 +66,8 @@ template <typename ValType>
 cads::List<ValType>& cads::List<ValType>::operator=(const List& other)
 {
     if (this != &other)
-    {
-        List temp{other};
-        swap(temp);
-    }
+        assign(other.begin(), other.end());
+
     return *this;
 }
 
@@ -84,8 +84,7 @@ cads::List<ValType>& cads::List<ValType>::operator=(List&& other) noexcept
 template <typename ValType>
 cads::List<ValType>& cads::List<ValType>::operator=(std::initializer_list<ValType> list)
 {
-    List temp{list};
-    swap(temp);
+    assign(list.begin(), list.end());
 
     return *this;
 }
@@ -245,6 +244,33 @@ typename cads::List<ValType>::Iterator cads::List<ValType>::insert(ConstIterator
     return Iterator{newNode};
 }
 
+template <typename ValType>
+typename cads::List<ValType>::Iterator cads::List<ValType>::insert(ConstIterator pos, const size_t count, const ValType& value)
+{
+    NodeBatch batch{count};
+    for (size_t i = 0; i < count; ++i)
+        batch.append(value);
+
+    m_size += batch.size();
+    return Iterator{ batch.commit(const_cast<Node*>(pos.m_node)) };
+}
+
+template <typename ValType>
+template <std::input_iterator It>
+typename cads::List<ValType>::Iterator cads::List<ValType>::insert(ConstIterator pos, It first, It last)
+{
+    size_t expected = 0;
+    if constexpr (std::forward_iterator<It>)
+        expected = static_cast<size_t>(std::distance(first, last));
+
+    NodeBatch batch{expected};
+    for (; first != last; ++first)
+        batch.append(*first);
+
+    m_size += batch.size();
+    return Iterator{ batch.commit(const_cast<Node*>(pos.m_node)) };
+}
+
 
 template <typename ValType>
 void cads::List<ValType>::pushFront(const ValType& value)
@@ -309,7 +335,7 @@ void cads::List<ValType>::popFront()
     m_sentinel->next = newFront;
     newFront->prev = m_sentinel;
 
-    delete frontToPop;
+    _freeNode(frontToPop);
 
     --m_size;
 }
@@ -325,7 +351,7 @@ void cads::List<ValType>::popBack()
     m_sentinel->prev = newBack;
     newBack->next = m_sentinel;
 
-    delete backToPop;
+    _freeNode(backToPop);
 
     --m_size;
 }
@@ -352,16 +378,10 @@ typename cads::List<ValType>::Iterator cads::List<ValType>::erase(ConstIterator
     firstNode->prev->next = lastNode;
     lastNode->prev = firstNode->prev;
 
-    Node* curr = firstNode;
-    while (curr != lastNode)
-    {
-        Node* next = curr->next;
-
-        delete curr;
+    _prefetchingWalk(firstNode, lastNode, [&count](Node* node) {
+        _freeNode(node);
         ++count;
-
-        curr = next;
-    }
+    });
 
     m_size -= count;
 
@@ -371,37 +391,67 @@ typename cads::List<ValType>::Iterator cads::List<ValType>::erase(ConstIterator
 template <typename ValType>
 void cads::List<ValType>::remove(const ValType& value)
 {
-    auto currIt = begin();
+    // `value` may live in one of the matching nodes; that one goes last
+    Node* holder = nullptr;
 
-    while (currIt != end())
-    {
-        if (*currIt == value)
-        {
-            currIt = erase(currIt);
-        }
+    _prefetchingWalk(m_sentinel->next, m_sentinel, [this, &value, &holder](Node* node) {
+        if (!(node->data == value))
+            return;
+
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        --m_size;
+
+        if (&node->data == &value)
+            holder = node;
         else
-            ++currIt;
-    }
-}
+            _freeNode(node);
+    });
 
+    if (holder != nullptr)
+        _freeNode(holder);
+}
 
 
 template <typename ValType>
 void cads::List<ValType>::clear() noexcept
 {
-    Node* curr = m_sentinel->next;
-    while (curr != m_sentinel)
-    {
-        Node* next = curr->next;
-        delete curr;
-        curr = next;
-    }
+    _prefetchingWalk(m_sentinel->next, m_sentinel, [](Node* node) {
+        _freeNode(node);
+    });
 
     m_sentinel->next = m_sentinel;
     m_sentinel->prev = m_sentinel;
     m_size = 0;
 }
 
+template <typename ValType>
+void cads::List<ValType>::assign(size_t count, const ValType& value)
+{
+    Iterator it = begin();
+    for (; it != end() && count > 0; ++it, --count)
+        *it = value;
+
+    // Surplus nodes go only after the last use of `value`, which may live in one of them
+    if (count == 0)
+        erase(it, end());
+    else
+        insert(end(), count, value);
+}
+
+template <typename ValType>
+template <std::input_iterator It>
+void cads::List<ValType>::assign(It first, It last)
+{
+    Iterator it = begin();
+    for (; it != end() && first != last; ++it, ++first)
+        *it = *first;
+
+    if (first == last)
+        erase(it, end());
+    else
+        insert(end(), first, last);
+}
 
 template <typename ValType>
 void cads::List<ValType>::swap(List& other) noexcept
@@ -413,18 +463,30 @@ void cads::List<ValType>::swap(List& other) noexcept
 template <typename ValType>
 void cads::List<ValType>::reverse()
 {
-    Node* curr = m_sentinel->next;
+    Node* first = m_sentinel->next;
 
     std::swap(m_sentinel->next, m_sentinel->prev);
 
-    while (curr != m_sentinel)
-    {
-        Node* next = curr->next;
+    _prefetchingWalk(first, m_sentinel, [](Node* node) {
+        std::swap(node->next, node->prev);
+    });
+}
 
-        std::swap(curr->next, curr->prev);
+template <typename ValType>
+template <typename Fn>
+void cads::List<ValType>::forEach(Fn&& fn)
+{
+    _prefetchingWalk(m_sentinel->next, m_sentinel, [&fn](Node* node) {
+        fn(node->data);
+    });
+}
 
-        curr = next;
-    }
+template <typename ValType>
+template <typename Fn>
+void cads::List<ValType>::forEach(Fn&& fn) const
+{
+    _prefetchingWalk(static_cast<const Node*>(m_sentinel->next), static_cast<const Node*>(m_sentinel),
+                     [&fn](const Node* node) { fn(node->data); });
 }
 
 
@@ -439,7 +501,7 @@ void cads::List<ValType>::splice(ConstIterator pos, List& other, ConstIterator f
 
     size_t count = 0;
     if (this != &other)
-        count = std::distance(first, last);
+        _prefetchingWalk(firstNode, lastNode, [&count](const Node*) { ++count; });
 
     Node* rangeFirst = firstNode;
     Node* rangeLast = lastNode->prev;
@@ -457,15 +519,124 @@ void cads::List<ValType>::splice(ConstIterator pos, List& other, ConstIterator f
     other.m_size -= count;
 }
 
+// - Layout -
+template <typename ValType>
+void cads::List<ValType>::compact()
+{
+    compact(begin(), m_size);
+}
+
+template <typename ValType>
+typename cads::List<ValType>::ConstIterator cads::List<ValType>::compact(ConstIterator from, size_t budget)
+{
+    Node* first = const_cast<Node*>(from.m_node);
+
+    size_t count = 0;
+    bool contiguous = first->slab != nullptr;
+    Node* after = first;
+    for (; after != m_sentinel && count < budget; after = after->next, ++count)
+    {
+        if (count > 0 && (after->slab != first->slab || after != first + count))
+            contiguous = false;
+    }
+
+    if (count == 0 || contiguous)
+        return ConstIterator{ after };
+
+    // Build the new nodes first so a throwing copy leaves the list untouched
+    Slab* slab = Slab::create(count);
+    size_t built = 0;
+    try
+    {
+        for (Node* curr = first; built < count; curr = curr->next, ++built)
+        {
+            Node* fresh = new (slab->slot(built)) Node{ std::move_if_noexcept(curr->data) };
+            fresh->slab = slab;
+            slab->acquire();
+        }
+    }
+    catch (...)
+    {
+        if (built == 0)
+            Slab::destroyEmpty(slab);
+        for (size_t i = 0; i < built; ++i)
+            _freeNode(slab->slot(i));
+        throw;
+    }
+
+    Node* prev = first->prev;
+    Node* curr = first;
+    for (size_t i = 0; i < count; ++i)
+    {
+        Node* next = curr->next;
+        _freeNode(curr);
+        curr = next;
+
+        Node* fresh = slab->slot(i);
+        fresh->prev = prev;
+        prev->next = fresh;
+        prev = fresh;
+    }
+
+    prev->next = after;
+    after->prev = prev;
+
+    return ConstIterator{ after };
+}
+
 
 // -- Private methods --
 template <typename ValType>
-typename cads::List<ValType>::Node* cads::List<ValType>::_initWithValues(Node* currTail, const ValType& value)
+void cads::List<ValType>::_freeNode(Node* node) noexcept
 {
-    Node* newNode = new Node{value, currTail, m_sentinel};
+    Slab* slab = node->slab;
+    if (slab == nullptr)
+    {
+        delete node;
+        return;
+    }
 
-    currTail->next = newNode;
-    m_sentinel->prev = newNode;
+    node->~Node();
+    slab->release();
+}
 
-    return newNode;
-}
\ No newline at end of file
+template <typename ValType>
+template <typename NodePtr, typename Visit>
+void cads::List<ValType>::_prefetchingWalk(NodePtr first, const NodePtr last, Visit visit)
+{
+    if constexpr (PrefetchDistance == 0)
+    {
+        while (first != last)
+        {
+            NodePtr next = first->next;
+            visit(first);
+            first = next;
+        }
+    }
+    else
+    {
+        // The lead cursor only chases `next`, so by the time `first` reaches a node it has
+        // usually been in cache for PrefetchDistance visits
+        NodePtr ahead = first;
+        for (size_t i = 0; i < PrefetchDistance && ahead != last; ++i)
+        {
+            ahead = ahead->next;
+            if (ahead != last)
+                detail::prefetch(ahead);
+        }
+
+        while (first != last)
+        {
+            if (ahead != last)
+            {
+                ahead = ahead->next;
+                if (ahead != last)
+                    detail::prefetch(ahead);
+            }
+
+            NodePtr next = first->next;
+            visit(first);
+            first = next;
+        }
+    }
+}
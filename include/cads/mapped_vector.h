@@ -0,0 +1,369 @@
+#pragma once
+
+#include "cads/vector.h"
+#include "cads/detail/posix_file.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cads
+{
+
+enum class MapMode
+{
+    ReadOnly,
+    ReadWrite
+};
+
+// Vector of trivially copyable values living in a shared mapping of a file. Opening is O(1):
+// the existing contents become the elements and the OS pages them in on first access.
+// The file is always as long as the capacity; growing extends it with ftruncate() and remaps,
+// and close() (or the destructor) truncates it back to size() so it can be reopened as is.
+// Remapping invalidates pointers and iterators, like a reallocation does for Vector.
+// A ReadOnly vector must only be read through; pushBack, resize and anything that changes
+// the capacity throw std::logic_error.
+// System call failures are reported as std::system_error. POSIX only.
+template<typename ValType>
+class MappedVector
+{
+    static_assert(std::is_trivially_copyable_v<ValType>, "MappedVector: ValType must be trivially copyable");
+
+public:
+    using Iterator             = typename Vector<ValType>::Iterator;
+    using ConstIterator        = typename Vector<ValType>::ConstIterator;
+    using ReverseIterator      = std::reverse_iterator<Iterator>;
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+    using value_type      = ValType;
+    using size_type       = std::size_t;
+    using reference       = ValType&;
+    using const_reference = const ValType&;
+    using pointer         = ValType*;
+    using const_pointer   = const ValType*;
+    using iterator        = Iterator;
+    using const_iterator  = ConstIterator;
+
+    // -- Constructors --
+    // Maps `path`, creating an empty file first in ReadWrite mode
+    explicit MappedVector(const std::filesystem::path& path, const MapMode mode = MapMode::ReadWrite)
+        : m_mode{mode}
+    {
+        const int flags = mode == MapMode::ReadOnly ? O_RDONLY : O_RDWR | O_CREAT;
+        m_file.reset(::open(path.c_str(), flags | O_CLOEXEC, 0644));
+        if (!m_file)
+            detail::throwErrno("MappedVector: cannot open file");
+
+        struct stat info{};
+        if (::fstat(m_file.get(), &info) != 0)
+            detail::throwErrno("MappedVector: cannot stat file");
+
+        const auto bytes = static_cast<size_type>(info.st_size);
+        if (bytes % sizeof(ValType) != 0)
+            throw std::runtime_error("MappedVector: file size is not a multiple of the element size");
+
+        m_size = bytes / sizeof(ValType);
+        _map(m_size);
+    }
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+
+    MappedVector(MappedVector&& other) noexcept
+        : m_file{std::move(other.m_file)}
+        , m_data{std::exchange(other.m_data, nullptr)}
+        , m_size{std::exchange(other.m_size, 0)}
+        , m_capacity{std::exchange(other.m_capacity, 0)}
+        , m_mode{other.m_mode}
+    { }
+
+    MappedVector& operator=(MappedVector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            _close();
+
+            m_file = std::move(other.m_file);
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_capacity = std::exchange(other.m_capacity, 0);
+            m_mode = other.m_mode;
+        }
+        return *this;
+    }
+
+    // -- Destructor --
+    // Same as close(), minus the error reporting
+    ~MappedVector()
+    {
+        _close();
+    }
+
+    // -- Methods --
+    // - Access -
+    ValType& operator[](const size_type index) { return m_data[index]; }
+    const ValType& operator[](const size_type index) const { return m_data[index]; }
+
+    ValType& at(const size_type index)
+    {
+        if (index >= m_size)
+            throw std::out_of_range("MappedVector::at: index out of range");
+        return m_data[index];
+    }
+
+    const ValType& at(const size_type index) const
+    {
+        if (index >= m_size)
+            throw std::out_of_range("MappedVector::at: index out of range");
+        return m_data[index];
+    }
+
+    ValType& front()
+    {
+        assert(!empty() && "MappedVector::front: vector is empty");
+        return m_data[0];
+    }
+
+    const ValType& front() const
+    {
+        assert(!empty() && "MappedVector::front: vector is empty");
+        return m_data[0];
+    }
+
+    ValType& back()
+    {
+        assert(!empty() && "MappedVector::back: vector is empty");
+        return m_data[m_size - 1];
+    }
+
+    const ValType& back() const
+    {
+        assert(!empty() && "MappedVector::back: vector is empty");
+        return m_data[m_size - 1];
+    }
+
+    ValType* data() noexcept { return m_data; }
+    const ValType* data() const noexcept { return m_data; }
+
+    // - Iterator methods -
+    Iterator begin() noexcept { return Iterator(m_data); }
+    ConstIterator begin() const noexcept { return ConstIterator(m_data); }
+    Iterator end() noexcept { return Iterator(m_data + m_size); }
+    ConstIterator end() const noexcept { return ConstIterator(m_data + m_size); }
+
+    ConstIterator cbegin() const noexcept { return begin(); }
+    ConstIterator cend() const noexcept { return end(); }
+
+    ReverseIterator rbegin() noexcept { return ReverseIterator(end()); }
+    ConstReverseIterator rbegin() const noexcept { return ConstReverseIterator(end()); }
+    ReverseIterator rend() noexcept { return ReverseIterator(begin()); }
+    ConstReverseIterator rend() const noexcept { return ConstReverseIterator(begin()); }
+
+    ConstReverseIterator crbegin() const noexcept { return rbegin(); }
+    ConstReverseIterator crend() const noexcept { return rend(); }
+
+    // - Capacity -
+    [[nodiscard]] size_type size() const noexcept { return m_size; }
+    [[nodiscard]] size_type capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    [[nodiscard]] MapMode mode() const noexcept { return m_mode; }
+    [[nodiscard]] bool isOpen() const noexcept { return static_cast<bool>(m_file); }
+
+    void reserve(const size_type newCapacity)
+    {
+        if (newCapacity > m_capacity)
+            _setCapacity(newCapacity);
+    }
+
+    // Shrinks the file along with the mapping
+    void shrinkToFit()
+    {
+        if (m_capacity > m_size)
+            _setCapacity(m_size);
+    }
+
+    void resize(const size_type newSize)
+    {
+        resize(newSize, ValType{});
+    }
+
+    void resize(const size_type newSize, const ValType& value)
+    {
+        // `value` may live in the mapping, which can move
+        _checkWritable("MappedVector::resize");
+
+        const ValType copy = value;
+        if (newSize > m_capacity)
+            _grow(newSize);
+
+        std::fill(m_data + std::min(m_size, newSize), m_data + newSize, copy);
+        m_size = newSize;
+    }
+
+    // - Modifiers -
+    void pushBack(const ValType& value)
+    {
+        _checkWritable("MappedVector::pushBack");
+
+        const ValType copy = value;
+        if (m_size == m_capacity)
+            _grow(m_size + 1);
+
+        m_data[m_size] = copy;
+        ++m_size;
+    }
+
+    void popBack()
+    {
+        assert(!empty() && "MappedVector::popBack: vector is empty");
+        --m_size;
+    }
+
+    void clear() noexcept
+    {
+        m_size = 0;
+    }
+
+    // Writes dirty pages of the first size() elements back to the file, blocking until done
+    void flush()
+    {
+        if (m_size != 0 && ::msync(m_data, m_size * sizeof(ValType), MS_SYNC) != 0)
+            detail::throwErrno("MappedVector::flush: msync failed");
+    }
+
+    // Unmaps and truncates the file to size() elements. The vector is left empty and closed.
+    void close()
+    {
+        if (const int error = _close(); error != 0)
+            throw std::system_error(error, std::generic_category(), "MappedVector::close: cannot truncate file");
+    }
+
+private:
+    detail::FileDescriptor m_file;
+    ValType* m_data = nullptr;
+    size_type m_size = 0;
+    size_type m_capacity = 0;
+    MapMode m_mode;
+
+    static size_type _pageElements() noexcept
+    {
+        static const size_type elements = std::max<size_type>(1, static_cast<size_type>(::sysconf(_SC_PAGESIZE)) / sizeof(ValType));
+        return elements;
+    }
+
+    // Even within capacity: after a popBack() the slot past the end is still read-only memory
+    void _checkWritable(const char* what) const
+    {
+        if (m_mode == MapMode::ReadOnly)
+            throw std::logic_error(std::string{what} + ": the mapping is read-only");
+    }
+
+    // Doubling growth, never less than a page so small vectors don't remap on every push
+    void _grow(const size_type required)
+    {
+        _setCapacity(std::max({ required, m_capacity * 2, _pageElements() }));
+    }
+
+    // Maps the first `capacity` elements of the file; leaves the current mapping alone on failure
+    void _map(const size_type capacity)
+    {
+        if (capacity == 0)
+        {
+            m_data = nullptr;
+            m_capacity = 0;
+            return;
+        }
+
+        const int protection = m_mode == MapMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+        void* address = ::mmap(nullptr, capacity * sizeof(ValType), protection, MAP_SHARED, m_file.get(), 0);
+        if (address == MAP_FAILED)
+            detail::throwErrno("MappedVector: mmap failed");
+
+        m_data = static_cast<ValType*>(address);
+        m_capacity = capacity;
+    }
+
+    void _remap(const size_type newCapacity)
+    {
+#if defined(__linux__)
+        if (m_data != nullptr && newCapacity != 0)
+        {
+            void* address = ::mremap(m_data, m_capacity * sizeof(ValType), newCapacity * sizeof(ValType), MREMAP_MAYMOVE);
+            if (address == MAP_FAILED)
+                detail::throwErrno("MappedVector: mremap failed");
+
+            m_data = static_cast<ValType*>(address);
+            m_capacity = newCapacity;
+            return;
+        }
+#endif
+        ValType* oldData = m_data;
+        const size_type oldCapacity = m_capacity;
+
+        _map(newCapacity);
+        if (oldData != nullptr)
+            ::munmap(oldData, oldCapacity * sizeof(ValType));
+    }
+
+    // The file must cover the whole mapping: extend it before growing, cut it after shrinking
+    void _setCapacity(const size_type newCapacity)
+    {
+        _checkWritable("MappedVector: cannot resize");
+
+        if (newCapacity > m_capacity)
+        {
+            _truncateFile(newCapacity);
+            _remap(newCapacity);
+        }
+        else
+        {
+            _remap(newCapacity);
+            _truncateFile(newCapacity);
+        }
+    }
+
+    void _truncateFile(const size_type elements)
+    {
+        if (::ftruncate(m_file.get(), static_cast<off_t>(elements * sizeof(ValType))) != 0)
+            detail::throwErrno("MappedVector: cannot resize file");
+    }
+
+    // Returns the errno of a failed truncation, 0 otherwise
+    int _close() noexcept
+    {
+        if (!m_file)
+            return 0;
+
+        if (m_data != nullptr)
+            ::munmap(m_data, m_capacity * sizeof(ValType));
+
+        int error = 0;
+        if (m_mode == MapMode::ReadWrite &&
+            ::ftruncate(m_file.get(), static_cast<off_t>(m_size * sizeof(ValType))) != 0)
+        {
+            error = errno;
+        }
+
+        m_file.reset();
+        m_data = nullptr;
+        m_size = 0;
+        m_capacity = 0;
+        return error;
+    }
+};
+
+} // namespace cads
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cads
+{
+
+// Pointer stored as the distance from its own address to the target, so a structure made
+// of OffsetPtrs stays valid wherever the memory holding it is mapped, e.g. a shared memory
+// segment attached at different addresses in different processes. Both the OffsetPtr and
+// its target must live in the same mapping. Copying re-bases the offset to the copy's address.
+template<typename T>
+class OffsetPtr
+{
+public:
+    using element_type = T;
+
+    OffsetPtr() noexcept = default;
+
+    OffsetPtr(std::nullptr_t) noexcept {}
+
+    OffsetPtr(T* ptr) noexcept
+    {
+        _set(ptr);
+    }
+
+    OffsetPtr(const OffsetPtr& other) noexcept
+    {
+        _set(other.get());
+    }
+
+    OffsetPtr& operator=(const OffsetPtr& other) noexcept
+    {
+        _set(other.get());
+        return *this;
+    }
+
+    OffsetPtr& operator=(T* ptr) noexcept
+    {
+        _set(ptr);
+        return *this;
+    }
+
+    ~OffsetPtr() = default;
+
+    [[nodiscard]] T* get() const noexcept
+    {
+        if (m_offset == Null)
+            return nullptr;
+
+        return reinterpret_cast<T*>(reinterpret_cast<std::uintptr_t>(this) + m_offset);
+    }
+
+    T& operator*() const noexcept { return *get(); }
+    T* operator->() const noexcept { return get(); }
+    T& operator[](const std::ptrdiff_t index) const noexcept { return get()[index]; }
+
+    explicit operator bool() const noexcept
+    {
+        return m_offset != Null;
+    }
+
+    bool operator==(const OffsetPtr& other) const noexcept
+    {
+        return get() == other.get();
+    }
+
+private:
+    // An offset of 1 can never reach a properly aligned object, unlike 0 (self) for T = OffsetPtr
+    static constexpr std::uintptr_t Null = 1;
+
+    std::uintptr_t m_offset = Null;
+
+    void _set(T* ptr) noexcept
+    {
+        m_offset = ptr == nullptr
+            ? Null
+            : reinterpret_cast<std::uintptr_t>(ptr) - reinterpret_cast<std::uintptr_t>(this);
+    }
+};
+
+} // namespace cads
@@ -0,0 +1,675 @@
+#pragma once
+
+#include "cads/vector.h"
+#include "cads/detail/tagged_pointer.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace cads
+{
+
+namespace detail
+{
+
+// Edit token for PersistentVector nodes: a node stamped with the token of the operation
+// (or transient) touching it was created by that operation and may be modified in place
+inline std::uint64_t nextPersistentOwner() noexcept
+{
+    static std::atomic<std::uint64_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+} // namespace detail
+
+// Immutable vector with structural sharing: a 32-way trie of leaves plus a separate tail
+// leaf (Bagwell / Clojure layout). set(), pushBack() and popBack() return a new version in
+// O(log32 n), copying only the path to the touched leaf; everything else is shared with the
+// old version through atomic reference counts, so versions can be read and dropped from any
+// thread. Copying a version is O(1).
+// transient() gives a mutable builder that edits the nodes it created in place, for batches.
+// Only dense, append-at-the-end vectors are supported: without concatenation or slicing
+// there is no need for RRB relaxed nodes, and lookups stay pure radix arithmetic.
+template<typename ValType>
+class PersistentVector
+{
+    static constexpr unsigned Bits = 5;
+    static constexpr std::size_t Width = std::size_t{1} << Bits;
+    static constexpr std::size_t Mask = Width - 1;
+
+    struct Node
+    {
+        std::atomic<std::uint32_t> refs{1};
+        const bool leaf;
+        const std::uint64_t owner;
+
+        Node(const bool isLeaf, const std::uint64_t ownerToken) noexcept
+            : leaf{isLeaf}, owner{ownerToken} {}
+    };
+
+    struct Internal : Node
+    {
+        Node* children[Width] = {};
+
+        explicit Internal(const std::uint64_t ownerToken) noexcept
+            : Node{false, ownerToken} {}
+    };
+
+    struct Leaf : Node
+    {
+        std::uint32_t count = 0;
+        alignas(ValType) unsigned char storage[Width * sizeof(ValType)];
+
+        explicit Leaf(const std::uint64_t ownerToken) noexcept
+            : Node{true, ownerToken} {}
+
+        ValType* values() noexcept { return reinterpret_cast<ValType*>(storage); }
+        const ValType* values() const noexcept { return reinterpret_cast<const ValType*>(storage); }
+    };
+
+    struct Trie
+    {
+        Node* root = nullptr;   // Internal node at height `shift`, nullptr while everything fits the tail
+        Node* tail = nullptr;   // Leaf with the last 1..32 elements, nullptr when empty
+        std::size_t size = 0;
+        unsigned shift = Bits;
+    };
+
+public:
+    class Transient;
+
+    class ConstIterator
+    {
+    public:
+        // For integration with STL algorithms
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = ValType;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const ValType*;
+        using reference         = const ValType&;
+
+        ConstIterator() = default;
+
+        const ValType& operator*() const { return m_leaf[m_index & Mask]; }
+        const ValType* operator->() const noexcept { return &m_leaf[m_index & Mask]; }
+
+        // Descends the trie once per leaf, not once per element
+        ConstIterator& operator++()
+        {
+            ++m_index;
+            if ((m_index & Mask) == 0 && m_index < m_trie->size)
+                m_leaf = _leafFor(*m_trie, m_index)->values();
+            return *this;
+        }
+
+        ConstIterator operator++(int) { auto temp = *this; ++*this; return temp; }
+
+        bool operator==(const ConstIterator& other) const noexcept { return m_index == other.m_index; }
+
+    private:
+        friend class PersistentVector;
+
+        const Trie* m_trie = nullptr;
+        std::size_t m_index = 0;
+        const ValType* m_leaf = nullptr;
+
+        ConstIterator(const Trie* trie, const std::size_t index)
+            : m_trie{trie}, m_index{index}
+        {
+            if (index < trie->size)
+                m_leaf = _leafFor(*trie, index)->values();
+        }
+    };
+
+    using value_type      = ValType;
+    using size_type       = std::size_t;
+    using const_reference = const ValType&;
+    using const_iterator  = ConstIterator;
+
+    // -- Constructors --
+    PersistentVector() noexcept = default;
+
+    PersistentVector(std::initializer_list<ValType> list)
+    {
+        const std::uint64_t owner = detail::nextPersistentOwner();
+        for (const ValType& value : list)
+            _pushBack(m_trie, value, owner);
+    }
+
+    PersistentVector(const PersistentVector& other) noexcept
+        : m_trie{_share(other.m_trie)}
+    { }
+
+    PersistentVector(PersistentVector&& other) noexcept
+        : m_trie{std::exchange(other.m_trie, Trie{})}
+    { }
+
+    PersistentVector& operator=(const PersistentVector& other) noexcept
+    {
+        if (this != &other)
+        {
+            _releaseTrie(m_trie);
+            m_trie = _share(other.m_trie);
+        }
+        return *this;
+    }
+
+    PersistentVector& operator=(PersistentVector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            _releaseTrie(m_trie);
+            m_trie = std::exchange(other.m_trie, Trie{});
+        }
+        return *this;
+    }
+
+    // -- Destructor --
+    ~PersistentVector()
+    {
+        _releaseTrie(m_trie);
+    }
+
+    // -- Methods --
+    // - Access -
+    const ValType& operator[](const size_type index) const
+    {
+        return _leafFor(m_trie, index)->values()[index & Mask];
+    }
+
+    const ValType& at(const size_type index) const
+    {
+        if (index >= m_trie.size)
+            throw std::out_of_range("PersistentVector::at: index out of range");
+        return (*this)[index];
+    }
+
+    const ValType& back() const
+    {
+        assert(!empty() && "PersistentVector::back: vector is empty");
+        return (*this)[m_trie.size - 1];
+    }
+
+    ConstIterator begin() const { return ConstIterator(&m_trie, 0); }
+    ConstIterator end() const { return ConstIterator(&m_trie, m_trie.size); }
+
+    // - Size -
+    [[nodiscard]] size_type size() const noexcept { return m_trie.size; }
+    [[nodiscard]] bool empty() const noexcept { return m_trie.size == 0; }
+
+    // - New versions (this one is left untouched) -
+    [[nodiscard]] PersistentVector set(const size_type index, const ValType& value) const
+    {
+        assert(index < m_trie.size && "PersistentVector::set: index out of range");
+
+        PersistentVector result{*this};
+        _set(result.m_trie, index, value, detail::nextPersistentOwner());
+        return result;
+    }
+
+    [[nodiscard]] PersistentVector pushBack(const ValType& value) const
+    {
+        PersistentVector result{*this};
+        _pushBack(result.m_trie, value, detail::nextPersistentOwner());
+        return result;
+    }
+
+    [[nodiscard]] PersistentVector popBack() const
+    {
+        assert(!empty() && "PersistentVector::popBack: vector is empty");
+
+        PersistentVector result{*this};
+        _popBack(result.m_trie, detail::nextPersistentOwner());
+        return result;
+    }
+
+    // Mutable builder starting from this version
+    [[nodiscard]] Transient transient() const
+    {
+        return Transient{_share(m_trie)};
+    }
+
+    [[nodiscard]] Vector<ValType> toVector() const
+    {
+        Vector<ValType> result;
+        result.reserve(m_trie.size);
+        for (const ValType& value : *this)
+            result.pushBack(value);
+        return result;
+    }
+
+
+    // Batch editor: modifies the nodes it has already copied in place, so a run of edits costs
+    // one path copy per touched leaf instead of one per edit. Not thread-safe; persistent()
+    // ends the batch and hands the result over as an ordinary version.
+    class Transient
+    {
+    public:
+        Transient(const Transient&) = delete;
+        Transient& operator=(const Transient&) = delete;
+
+        Transient(Transient&& other) noexcept
+            : m_trie{std::exchange(other.m_trie, Trie{})}
+            , m_owner{std::exchange(other.m_owner, 0)}
+        { }
+
+        Transient& operator=(Transient&& other) noexcept
+        {
+            if (this != &other)
+            {
+                _releaseTrie(m_trie);
+                m_trie = std::exchange(other.m_trie, Trie{});
+                m_owner = std::exchange(other.m_owner, 0);
+            }
+            return *this;
+        }
+
+        ~Transient()
+        {
+            _releaseTrie(m_trie);
+        }
+
+        const ValType& operator[](const size_type index) const
+        {
+            return _leafFor(m_trie, index)->values()[index & Mask];
+        }
+
+        [[nodiscard]] size_type size() const noexcept { return m_trie.size; }
+        [[nodiscard]] bool empty() const noexcept { return m_trie.size == 0; }
+
+        Transient& set(const size_type index, const ValType& value)
+        {
+            assert(m_owner != 0 && "PersistentVector::Transient: used after persistent()");
+            assert(index < m_trie.size && "PersistentVector::Transient::set: index out of range");
+
+            _set(m_trie, index, value, m_owner);
+            return *this;
+        }
+
+        Transient& pushBack(const ValType& value)
+        {
+            assert(m_owner != 0 && "PersistentVector::Transient: used after persistent()");
+
+            _pushBack(m_trie, value, m_owner);
+            return *this;
+        }
+
+        Transient& popBack()
+        {
+            assert(m_owner != 0 && "PersistentVector::Transient: used after persistent()");
+            assert(!empty() && "PersistentVector::Transient::popBack: vector is empty");
+
+            _popBack(m_trie, m_owner);
+            return *this;
+        }
+
+        // Freezes the edited nodes: nothing else holds this transient's token
+        [[nodiscard]] PersistentVector persistent() &&
+        {
+            m_owner = 0;
+
+            PersistentVector result;
+            result.m_trie = std::exchange(m_trie, Trie{});
+            return result;
+        }
+
+    private:
+        friend class PersistentVector;
+
+        Trie m_trie;
+        std::uint64_t m_owner;
+
+        explicit Transient(const Trie& trie) noexcept
+            : m_trie{trie}
+            , m_owner{detail::nextPersistentOwner()}
+        { }
+    };
+
+private:
+    Trie m_trie;
+
+    // - Reference counting -
+    static Node* _acquire(Node* node) noexcept
+    {
+        if (node != nullptr)
+            node->refs.fetch_add(1, std::memory_order_relaxed);
+        return node;
+    }
+
+    static void _release(Node* node) noexcept
+    {
+        if (node == nullptr || node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+
+        if (node->leaf)
+        {
+            _destroyLeaf(static_cast<Leaf*>(node));
+        }
+        else
+        {
+            auto* internal = static_cast<Internal*>(node);
+            for (Node* child : internal->children)
+                _release(child);
+            delete internal;
+        }
+    }
+
+    static void _destroyLeaf(Leaf* leaf) noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<ValType>)
+        {
+            for (std::uint32_t i = 0; i < leaf->count; ++i)
+                leaf->values()[i].~ValType();
+        }
+        delete leaf;
+    }
+
+    static Trie _share(const Trie& trie) noexcept
+    {
+        _acquire(trie.root);
+        _acquire(trie.tail);
+        return trie;
+    }
+
+    static void _releaseTrie(Trie& trie) noexcept
+    {
+        _release(trie.root);
+        _release(trie.tail);
+        trie = Trie{};
+    }
+
+    // - Copy on write -
+    static Node* _copy(const Node* node, const std::uint64_t owner)
+    {
+        if (!node->leaf)
+        {
+            auto* copy = new Internal{owner};
+            for (std::size_t i = 0; i < Width; ++i)
+                copy->children[i] = _acquire(static_cast<const Internal*>(node)->children[i]);
+            return copy;
+        }
+
+        const auto* source = static_cast<const Leaf*>(node);
+        auto* copy = new Leaf{owner};
+        try
+        {
+            for (; copy->count < source->count; ++copy->count)
+                new (copy->values() + copy->count) ValType(source->values()[copy->count]);
+        }
+        catch (...)
+        {
+            _destroyLeaf(copy);
+            throw;
+        }
+        return copy;
+    }
+
+    // The node in `slot`, replaced by a private copy unless `owner` created it
+    template<typename NodeType>
+    static NodeType* _editable(Node*& slot, const std::uint64_t owner)
+    {
+        if (slot->owner != owner)
+        {
+            Node* copy = _copy(slot, owner);
+            _release(slot);
+            slot = copy;
+        }
+        return static_cast<NodeType*>(slot);
+    }
+
+    // - Trie navigation -
+    static std::size_t _tailOffset(const Trie& trie) noexcept
+    {
+        return trie.size < Width ? 0 : ((trie.size - 1) >> Bits) << Bits;
+    }
+
+    static const Leaf* _leafFor(const Trie& trie, const std::size_t index) noexcept
+    {
+        assert(index < trie.size && "PersistentVector: index out of range");
+
+        if (index >= _tailOffset(trie))
+            return static_cast<const Leaf*>(trie.tail);
+
+        const Node* node = trie.root;
+        for (unsigned level = trie.shift; level > 0; level -= Bits)
+            node = static_cast<const Internal*>(node)->children[(index >> level) & Mask];
+        return static_cast<const Leaf*>(node);
+    }
+
+    // - Edits, shared by versions and transients -
+    static void _set(Trie& trie, const std::size_t index, const ValType& value, const std::uint64_t owner)
+    {
+        Node** slot = &trie.tail;
+        if (index < _tailOffset(trie))
+        {
+            slot = &trie.root;
+            for (unsigned level = trie.shift; level > 0; level -= Bits)
+                slot = &_editable<Internal>(*slot, owner)->children[(index >> level) & Mask];
+        }
+
+        _editable<Leaf>(*slot, owner)->values()[index & Mask] = value;
+    }
+
+    static void _pushBack(Trie& trie, const ValType& value, const std::uint64_t owner)
+    {
+        if (trie.tail != nullptr && trie.size - _tailOffset(trie) < Width)
+        {
+            Leaf* tail = _editable<Leaf>(trie.tail, owner);
+            new (tail->values() + tail->count) ValType(value);
+            ++tail->count;
+            ++trie.size;
+            return;
+        }
+
+        // Tail full (or missing): start a new one, then move the old one into the trie
+        auto* newTail = new Leaf{owner};
+        try
+        {
+            new (newTail->values()) ValType(value);
+            newTail->count = 1;
+
+            if (trie.tail != nullptr)
+                _pushTail(trie, owner);
+        }
+        catch (...)
+        {
+            _destroyLeaf(newTail);
+            throw;
+        }
+
+        trie.tail = newTail;
+        ++trie.size;
+    }
+
+    // Moves the full tail (and its reference) into the rightmost free leaf slot of the trie
+    static void _pushTail(Trie& trie, const std::uint64_t owner)
+    {
+        const std::size_t lastIndex = trie.size - 1;
+
+        if (trie.root == nullptr)
+        {
+            trie.root = new Internal{owner};
+        }
+        else if ((trie.size >> Bits) > (std::size_t{1} << trie.shift))
+        {
+            // Root is full: grow the trie by one level
+            auto* newRoot = new Internal{owner};
+            newRoot->children[0] = trie.root;
+            trie.root = newRoot;
+            trie.shift += Bits;
+        }
+
+        Node** slot = &trie.root;
+        for (unsigned level = trie.shift; level > Bits; level -= Bits)
+        {
+            Node*& child = _editable<Internal>(*slot, owner)->children[(lastIndex >> level) & Mask];
+            if (child == nullptr)
+                child = new Internal{owner};
+            slot = &child;
+        }
+
+        _editable<Internal>(*slot, owner)->children[(lastIndex >> Bits) & Mask] = trie.tail;
+        trie.tail = nullptr;
+    }
+
+    static void _popBack(Trie& trie, const std::uint64_t owner)
+    {
+        if (trie.size - _tailOffset(trie) > 1)
+        {
+            Leaf* tail = _editable<Leaf>(trie.tail, owner);
+            --tail->count;
+            tail->values()[tail->count].~ValType();
+            --trie.size;
+            return;
+        }
+
+        if (trie.size == 1)
+        {
+            _releaseTrie(trie);
+            return;
+        }
+
+        // The tail empties: the last leaf of the trie takes its place
+        Node* newTail = _acquire(const_cast<Leaf*>(_leafFor(trie, trie.size - 2)));
+        _popTail(trie.root, trie.shift, trie.size - 2, owner);
+
+        _release(trie.tail);
+        trie.tail = newTail;
+        --trie.size;
+
+        if (trie.root == nullptr)
+        {
+            trie.shift = Bits;
+        }
+        else if (trie.shift > Bits && static_cast<Internal*>(trie.root)->children[1] == nullptr)
+        {
+            // Only one subtree left: drop a level
+            Node* child = _acquire(static_cast<Internal*>(trie.root)->children[0]);
+            _release(trie.root);
+            trie.root = child;
+            trie.shift -= Bits;
+        }
+    }
+
+    // Removes the leaf holding `lastIndex` below `slot`; empty subtrees are released and nulled
+    static void _popTail(Node*& slot, const unsigned level, const std::size_t lastIndex, const std::uint64_t owner)
+    {
+        // Leaf position within this subtree; 0 means the leaf is all the subtree holds
+        if ((lastIndex & ((std::size_t{1} << (level + Bits)) - 1)) >> Bits == 0)
+        {
+            _release(slot);
+            slot = nullptr;
+            return;
+        }
+
+        Node*& child = _editable<Internal>(slot, owner)->children[(lastIndex >> level) & Mask];
+        if (level == Bits)
+        {
+            _release(child);
+            child = nullptr;
+        }
+        else
+        {
+            _popTail(child, level - Bits, lastIndex, owner);
+        }
+    }
+
+    template<typename T>
+    friend class AtomicPersistentVector;
+};
+
+
+// Holds the latest PersistentVector for many readers and a writer without locks. load()
+// copies the current version out (a couple of atomic increments, never blocked by the writer),
+// store() publishes a new one. The current version is kept in a reference-counted holder and
+// readers announce themselves in a counter packed next to its pointer (split reference
+// counting), so a holder is never freed while a reader is still between its two steps.
+template<typename ValType>
+class AtomicPersistentVector
+{
+public:
+    explicit AtomicPersistentVector(PersistentVector<ValType> initial = {})
+    {
+        detail::TaggedPtr<Snapshot> empty{nullptr, 0};
+        m_current.compareExchange(empty, {new Snapshot{std::move(initial)}, 0});
+    }
+
+    AtomicPersistentVector(const AtomicPersistentVector&) = delete;
+    AtomicPersistentVector& operator=(const AtomicPersistentVector&) = delete;
+
+    ~AtomicPersistentVector()
+    {
+        _retire(m_current.load());
+    }
+
+    [[nodiscard]] PersistentVector<ValType> load() const
+    {
+        // Announce: the holder now cannot be freed until we retract
+        detail::TaggedPtr<Snapshot> current = m_current.load();
+        while (!m_current.compareExchange(current, {current.ptr, current.tag + 1}))
+        { }
+
+        PersistentVector<ValType> result{current.ptr->version};
+
+        // Retract; if the holder was replaced meanwhile, store() moved our announcement into
+        // its reference count and that is what we drop instead
+        detail::TaggedPtr<Snapshot> expected{current.ptr, current.tag + 1};
+        while (expected.ptr == current.ptr)
+        {
+            if (m_current.compareExchange(expected, {expected.ptr, expected.tag - 1}))
+                return result;
+        }
+        _releaseSnapshot(current.ptr);
+
+        return result;
+    }
+
+    void store(PersistentVector<ValType> version)
+    {
+        auto* snapshot = new Snapshot{std::move(version)};
+
+        detail::TaggedPtr<Snapshot> previous = m_current.load();
+        while (!m_current.compareExchange(previous, {snapshot, 0}))
+        { }
+
+        _retire(previous);
+    }
+
+private:
+    struct Snapshot
+    {
+        explicit Snapshot(PersistentVector<ValType>&& value) noexcept
+            : version{std::move(value)} {}
+
+        // Readers that announced themselves in the slot and have not released yet. Starts at 0
+        // and may dip below it: a reader can release before _retire() hands its announcement over.
+        std::atomic<std::int64_t> refs{0};
+        PersistentVector<ValType> version;
+    };
+
+    mutable detail::AtomicTaggedPtr<Snapshot> m_current;
+
+    // Called once the holder left the slot: its pending readers become real references, and
+    // whoever brings the count back to zero (this or the last reader) frees it
+    static void _retire(const detail::TaggedPtr<Snapshot> previous) noexcept
+    {
+        const auto pending = static_cast<std::int64_t>(previous.tag);
+        if (previous.ptr->refs.fetch_add(pending, std::memory_order_acq_rel) == -pending)
+            delete previous.ptr;
+    }
+
+    static void _releaseSnapshot(Snapshot* snapshot) noexcept
+    {
+        if (snapshot->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete snapshot;
+    }
+};
+
+} // namespace cads
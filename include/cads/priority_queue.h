@@ -0,0 +1,423 @@
+#pragma once
+
+#include "cads/vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <utility>
+
+namespace cads
+{
+
+// Max-heap by `Compare` (like std::priority_queue): top() is the element no other ranks above.
+// An `Arity`-ary layout halves the height of a binary heap for Arity = 4, and the children
+// of a node share one or two cache lines.
+template<typename ValType, typename Compare = std::less<ValType>, typename Container = Vector<ValType>, size_t Arity = 4>
+class PriorityQueue // d-ary heap based on `Container`
+{
+    static_assert(Arity >= 2, "PriorityQueue needs at least two children per node");
+
+public:
+    using value_type      = ValType;
+    using size_type       = std::size_t;
+    using reference       = ValType&;
+    using const_reference = const ValType&;
+    using pointer         = ValType*;
+    using const_pointer   = const ValType*;
+
+    PriorityQueue() = default;
+
+    explicit PriorityQueue(const Compare& compare)
+        : m_compare(compare)
+    { }
+
+    // Heapifies `container` in O(n)
+    static PriorityQueue buildFrom(Container container, const Compare& compare = Compare{})
+    {
+        PriorityQueue queue{compare};
+        queue.m_container = std::move(container);
+
+        const size_t size = queue.m_container.size();
+        if (size > 1)
+        {
+            for (size_t i = (size - 2) / Arity + 1; i-- > 0; )
+                queue._siftDown(i);
+        }
+
+        return queue;
+    }
+
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_container.empty();
+    }
+
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return m_container.size();
+    }
+
+
+    const_reference top() const
+    {
+        return m_container.front();
+    }
+
+
+    void push(const ValType& val)
+    {
+        m_container.pushBack(val);
+        _siftUp(m_container.size() - 1);
+    }
+
+    void push(ValType&& val)
+    {
+        m_container.pushBack(std::move(val));
+        _siftUp(m_container.size() - 1);
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args)
+    {
+        m_container.pushBack(ValType(std::forward<Args>(args)...));
+        _siftUp(m_container.size() - 1);
+    }
+
+
+    void pop()
+    {
+        if (m_container.size() > 1)
+        {
+            m_container[0] = std::move(m_container.back());
+            m_container.popBack();
+            _siftDown(0);
+        }
+        else
+            m_container.popBack();
+    }
+
+
+    void swap(PriorityQueue& other) noexcept
+    {
+        std::swap(m_container, other.m_container);
+        std::swap(m_compare, other.m_compare);
+    }
+
+private:
+    Container m_container;
+    Compare m_compare;
+
+    // Both sifts carry a hole instead of swapping, one move per level
+    void _siftUp(size_t index)
+    {
+        ValType value = std::move(m_container[index]);
+
+        while (index > 0)
+        {
+            const size_t parent = (index - 1) / Arity;
+            if (!m_compare(m_container[parent], value))
+                break;
+
+            m_container[index] = std::move(m_container[parent]);
+            index = parent;
+        }
+
+        m_container[index] = std::move(value);
+    }
+
+    void _siftDown(size_t index)
+    {
+        const size_t size = m_container.size();
+        ValType value = std::move(m_container[index]);
+
+        while (true)
+        {
+            const size_t first = index * Arity + 1;
+            if (first >= size)
+                break;
+
+            const size_t last = first + Arity < size ? first + Arity : size;
+
+            size_t best = first;
+            for (size_t child = first + 1; child < last; ++child)
+            {
+                if (m_compare(m_container[best], m_container[child]))
+                    best = child;
+            }
+
+            if (!m_compare(value, m_container[best]))
+                break;
+
+            m_container[index] = std::move(m_container[best]);
+            index = best;
+        }
+
+        m_container[index] = std::move(value);
+    }
+};
+
+
+// PriorityQueue whose entries are addressed by stable handles, for algorithms that need
+// to reprioritize or cancel queued entries (Dijkstra, timer wheels). Handles of popped or
+// erased entries are recycled by later pushes.
+template<typename ValType, typename Compare = std::less<ValType>, size_t Arity = 4>
+class IndexedPriorityQueue // d-ary heap with a handle -> position table
+{
+    static_assert(Arity >= 2, "IndexedPriorityQueue needs at least two children per node");
+
+public:
+    using value_type      = ValType;
+    using size_type       = std::size_t;
+    using reference       = ValType&;
+    using const_reference = const ValType&;
+    using Handle          = std::size_t;
+
+    IndexedPriorityQueue() = default;
+
+    explicit IndexedPriorityQueue(const Compare& compare)
+        : m_compare(compare)
+    { }
+
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_heap.empty();
+    }
+
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return m_heap.size();
+    }
+
+    [[nodiscard]] bool contains(const Handle handle) const noexcept
+    {
+        return handle < m_positions.size() && m_positions[handle] != NotQueued;
+    }
+
+
+    const_reference top() const
+    {
+        return m_heap.front().value;
+    }
+
+    Handle topHandle() const
+    {
+        return m_heap.front().handle;
+    }
+
+    const_reference value(const Handle handle) const
+    {
+        assert(contains(handle) && "value() called with a handle that is not queued");
+        return m_heap[m_positions[handle]].value;
+    }
+
+
+    Handle push(const ValType& val)
+    {
+        return _push(ValType(val));
+    }
+
+    Handle push(ValType&& val)
+    {
+        return _push(std::move(val));
+    }
+
+    template<typename... Args>
+    Handle emplace(Args&&... args)
+    {
+        return _push(ValType(std::forward<Args>(args)...));
+    }
+
+
+    void pop()
+    {
+        _removeAt(0);
+    }
+
+    void erase(const Handle handle)
+    {
+        assert(contains(handle) && "erase() called with a handle that is not queued");
+        _removeAt(m_positions[handle]);
+    }
+
+
+    // Moves the entry towards the top: `val` must not rank below the current value.
+    // With `std::greater` this is the classic decrease-key of a min-heap.
+    void decreaseKey(const Handle handle, ValType val)
+    {
+        assert(contains(handle) && "decreaseKey() called with a handle that is not queued");
+
+        const size_t position = m_positions[handle];
+        assert(!m_compare(val, m_heap[position].value) && "decreaseKey() would lower the priority");
+
+        m_heap[position].value = std::move(val);
+        _siftUp(position);
+    }
+
+    // Replaces the value and restores the heap in whichever direction it moved
+    void update(const Handle handle, ValType val)
+    {
+        assert(contains(handle) && "update() called with a handle that is not queued");
+
+        const size_t position = m_positions[handle];
+        const bool raised = m_compare(m_heap[position].value, val);
+
+        m_heap[position].value = std::move(val);
+
+        if (raised)
+            _siftUp(position);
+        else
+            _siftDown(position);
+    }
+
+
+    void clear() noexcept
+    {
+        for (size_t i = 0; i < m_heap.size(); ++i)
+        {
+            m_positions[m_heap[i].handle] = NotQueued;
+            m_freeHandles.pushBack(m_heap[i].handle);
+        }
+        m_heap.clear();
+    }
+
+    void swap(IndexedPriorityQueue& other) noexcept
+    {
+        m_heap.swap(other.m_heap);
+        m_positions.swap(other.m_positions);
+        m_freeHandles.swap(other.m_freeHandles);
+        std::swap(m_compare, other.m_compare);
+    }
+
+private:
+    struct Entry
+    {
+        ValType value;
+        Handle handle;
+    };
+
+    static constexpr size_t NotQueued = std::numeric_limits<size_t>::max();
+
+    Vector<Entry> m_heap;
+    Vector<size_t> m_positions;  // Handle -> index into `m_heap`, or NotQueued
+    Vector<Handle> m_freeHandles;
+    Compare m_compare;
+
+    // The free list always has room for every handle ever minted, so handing one back (pop,
+    // erase, clear, a failed push) never allocates
+    Handle _push(ValType&& val)
+    {
+        const bool reused = !m_freeHandles.empty();
+        Handle handle;
+        if (reused)
+        {
+            handle = m_freeHandles.back();
+        }
+        else
+        {
+            handle = m_positions.size();
+            if (m_freeHandles.capacity() <= handle)
+                m_freeHandles.reserve(handle == 0 ? 1 : handle * 2);
+            m_positions.pushBack(NotQueued);
+        }
+
+        try
+        {
+            m_heap.pushBack(Entry{std::move(val), handle});
+        }
+        catch (...)
+        {
+            if (!reused)
+                m_freeHandles.pushBack(handle);
+            throw;
+        }
+        if (reused)
+            m_freeHandles.popBack();
+
+        m_positions[handle] = m_heap.size() - 1;
+        _siftUp(m_heap.size() - 1);
+
+        return handle;
+    }
+
+    void _removeAt(const size_t position)
+    {
+        const Handle removed = m_heap[position].handle;
+        const size_t last = m_heap.size() - 1;
+
+        if (position != last)
+        {
+            m_heap[position] = std::move(m_heap[last]);
+            m_positions[m_heap[position].handle] = position;
+        }
+        m_heap.popBack();
+
+        m_positions[removed] = NotQueued;
+        m_freeHandles.pushBack(removed);
+
+        if (position < m_heap.size())
+        {
+            // The moved-in entry may belong above or below its new spot
+            if (position > 0 && m_compare(m_heap[(position - 1) / Arity].value, m_heap[position].value))
+                _siftUp(position);
+            else
+                _siftDown(position);
+        }
+    }
+
+    void _siftUp(size_t index)
+    {
+        Entry entry = std::move(m_heap[index]);
+
+        while (index > 0)
+        {
+            const size_t parent = (index - 1) / Arity;
+            if (!m_compare(m_heap[parent].value, entry.value))
+                break;
+
+            m_heap[index] = std::move(m_heap[parent]);
+            m_positions[m_heap[index].handle] = index;
+            index = parent;
+        }
+
+        m_positions[entry.handle] = index;
+        m_heap[index] = std::move(entry);
+    }
+
+    void _siftDown(size_t index)
+    {
+        const size_t size = m_heap.size();
+        Entry entry = std::move(m_heap[index]);
+
+        while (true)
+        {
+            const size_t first = index * Arity + 1;
+            if (first >= size)
+                break;
+
+            const size_t last = first + Arity < size ? first + Arity : size;
+
+            size_t best = first;
+            for (size_t child = first + 1; child < last; ++child)
+            {
+                if (m_compare(m_heap[best].value, m_heap[child].value))
+                    best = child;
+            }
+
+            if (!m_compare(entry.value, m_heap[best].value))
+                break;
+
+            m_heap[index] = std::move(m_heap[best]);
+            m_positions[m_heap[index].handle] = index;
+            index = best;
+        }
+
+        m_positions[entry.handle] = index;
+        m_heap[index] = std::move(entry);
+    }
+};
+
+} // namespace cads
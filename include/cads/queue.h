@@ -66,6 +66,13 @@ public:
     }
 
 
+    // Read-only access to the underlying container, e.g. to iterate or serialize it
+    const Container& container() const noexcept
+    {
+        return m_container;
+    }
+
+
     void swap(Queue& other) noexcept
     {
         std::swap(m_container, other.m_container);
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "cads/detail/epoch.h"
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+namespace cads
+{
+
+// Read-copy-update cell for read-mostly containers (Vector, List, BTreeMap, ...). Readers
+// take a ReadGuard and see an immutable snapshot; entering and leaving is wait-free and
+// touches no shared cache line, so readers never contend with each other or with writers.
+// Writers are serialised: update() copies the current value, modifies the copy and swaps it
+// in, and the old version is handed to epoch-based reclamation instead of being reference
+// counted. A snapshot stays valid for as long as its guard lives; keep guards short, since
+// an open guard holds back the reclamation of every version retired meanwhile.
+template<typename Container>
+class RcuBox
+{
+public:
+    // Pinned view of one version; must be released on the thread that took it
+    class ReadGuard
+    {
+    public:
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        const Container& operator*() const noexcept { return *m_value; }
+        const Container* operator->() const noexcept { return m_value; }
+        const Container* get() const noexcept { return m_value; }
+
+    private:
+        friend class RcuBox;
+
+        detail::EpochDomain::Guard m_guard;
+        const Container* m_value;
+
+        explicit ReadGuard(const RcuBox& box) noexcept
+            : m_guard{detail::EpochDomain::global()}
+            , m_value{box.m_current.load(std::memory_order_acquire)}
+        { }
+    };
+
+    explicit RcuBox(Container initial = Container{})
+        : m_current{new Container(std::move(initial))}
+    { }
+
+    RcuBox(const RcuBox&) = delete;
+    RcuBox& operator=(const RcuBox&) = delete;
+
+    // No reader may still hold a guard; versions already retired are freed by the domain
+    ~RcuBox()
+    {
+        delete m_current.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] ReadGuard read() const noexcept
+    {
+        return ReadGuard{*this};
+    }
+
+    // Copy of the current version, for callers that want to keep it
+    [[nodiscard]] Container snapshot() const
+    {
+        const ReadGuard guard = read();
+        return *guard;
+    }
+
+    // Clone, let `modify` edit the clone, publish it. If `modify` throws nothing is published.
+    template<typename Fn>
+    void update(Fn&& modify)
+    {
+        const std::lock_guard lock{m_writeMutex};
+
+        auto* next = new Container(*m_current.load(std::memory_order_relaxed));
+        try
+        {
+            std::forward<Fn>(modify)(*next);
+        }
+        catch (...)
+        {
+            delete next;
+            throw;
+        }
+        _publish(next);
+    }
+
+    void store(Container value)
+    {
+        auto* next = new Container(std::move(value));
+
+        const std::lock_guard lock{m_writeMutex};
+        _publish(next);
+    }
+
+private:
+    std::atomic<Container*> m_current;
+    std::mutex m_writeMutex;
+
+    void _publish(Container* next)
+    {
+        Container* previous = m_current.exchange(next, std::memory_order_acq_rel);
+        detail::EpochDomain::global().retire(previous);
+    }
+};
+
+} // namespace cads
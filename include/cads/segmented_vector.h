@@ -0,0 +1,238 @@
+#pragma once
+
+#include "cads/detail/segment_index.h"
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+
+namespace cads
+{
+
+// Growable array that never relocates its elements: storage is a table of segments whose
+// sizes double (BaseSize, 2*BaseSize, 4*BaseSize, ...). Growing allocates a new segment and
+// leaves the old ones alone, so pointers, references and iterators to existing elements
+// stay valid until the element itself is removed.
+template<typename ValType, std::size_t BaseSize = 16>
+class SegmentedVector
+{
+    using Segments = detail::SegmentIndex<BaseSize>;
+
+public:
+    class Iterator;
+    class ConstIterator;
+
+    using value_type      = ValType;
+    using size_type       = std::size_t;
+    using reference       = ValType&;
+    using const_reference = const ValType&;
+    using pointer         = ValType*;
+    using const_pointer   = const ValType*;
+    using iterator        = Iterator;
+    using const_iterator  = ConstIterator;
+
+    // -- Iterators --
+    // Steps through a segment with a plain pointer and only redoes the index math when it
+    // crosses into the next segment
+    class Iterator
+    {
+    public:
+        // For integration with STL algorithms
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = ValType;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = ValType*;
+        using reference         = ValType&;
+
+        friend class ConstIterator;
+
+        Iterator() = default;
+        Iterator(SegmentedVector* vec, size_type index) : m_vec(vec), m_index(index) { _seat(); }
+
+        ValType& operator*() const { return *m_ptr; }
+        ValType* operator->() const noexcept { return m_ptr; }
+
+        Iterator& operator++()
+        {
+            ++m_index;
+            if (++m_ptr == m_segmentEnd)
+                _seat();
+            return *this;
+        }
+        Iterator operator++(int) { auto temp = *this; ++*this; return temp; }
+        Iterator& operator--() { --m_index; _seat(); return *this; }
+        Iterator operator--(int) { auto temp = *this; --*this; return temp; }
+
+        Iterator& operator+=(std::ptrdiff_t n) { m_index += n; _seat(); return *this; }
+        Iterator& operator-=(std::ptrdiff_t n) { m_index -= n; _seat(); return *this; }
+
+        Iterator operator+(std::ptrdiff_t n) const { return Iterator(m_vec, m_index + n); }
+        Iterator operator-(std::ptrdiff_t n) const { return Iterator(m_vec, m_index - n); }
+        std::ptrdiff_t operator-(const Iterator& other) const
+        {
+            return static_cast<std::ptrdiff_t>(m_index) - static_cast<std::ptrdiff_t>(other.m_index);
+        }
+
+        friend Iterator operator+(std::ptrdiff_t n, const Iterator& it) { return it + n; }
+
+        ValType& operator[](std::ptrdiff_t n) const { return (*m_vec)[m_index + n]; }
+
+        bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+        auto operator<=>(const Iterator& other) const { return m_index <=> other.m_index; }
+
+    private:
+        SegmentedVector* m_vec = nullptr;
+        size_type m_index = 0;
+        ValType* m_ptr = nullptr;
+        ValType* m_segmentEnd = nullptr;
+
+        void _seat() { m_vec->_seat(m_index, m_ptr, m_segmentEnd); }
+    };
+
+    class ConstIterator
+    {
+    public:
+        // For integration with STL algorithms
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = ValType;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const ValType*;
+        using reference         = const ValType&;
+
+        ConstIterator() = default;
+        ConstIterator(const SegmentedVector* vec, size_type index) : m_vec(vec), m_index(index) { _seat(); }
+
+        ConstIterator(const Iterator& it)
+            : m_vec(it.m_vec), m_index(it.m_index), m_ptr(it.m_ptr), m_segmentEnd(it.m_segmentEnd)
+        { }
+
+        const ValType& operator*() const { return *m_ptr; }
+        const ValType* operator->() const noexcept { return m_ptr; }
+
+        ConstIterator& operator++()
+        {
+            ++m_index;
+            if (++m_ptr == m_segmentEnd)
+                _seat();
+            return *this;
+        }
+        ConstIterator operator++(int) { auto temp = *this; ++*this; return temp; }
+        ConstIterator& operator--() { --m_index; _seat(); return *this; }
+        ConstIterator operator--(int) { auto temp = *this; --*this; return temp; }
+
+        ConstIterator& operator+=(std::ptrdiff_t n) { m_index += n; _seat(); return *this; }
+        ConstIterator& operator-=(std::ptrdiff_t n) { m_index -= n; _seat(); return *this; }
+
+        ConstIterator operator+(std::ptrdiff_t n) const { return ConstIterator(m_vec, m_index + n); }
+        ConstIterator operator-(std::ptrdiff_t n) const { return ConstIterator(m_vec, m_index - n); }
+        std::ptrdiff_t operator-(const ConstIterator& other) const
+        {
+            return static_cast<std::ptrdiff_t>(m_index) - static_cast<std::ptrdiff_t>(other.m_index);
+        }
+
+        friend ConstIterator operator+(std::ptrdiff_t n, const ConstIterator& it) { return it + n; }
+
+        const ValType& operator[](std::ptrdiff_t n) const { return (*m_vec)[m_index + n]; }
+
+        bool operator==(const ConstIterator& other) const { return m_index == other.m_index; }
+        auto operator<=>(const ConstIterator& other) const { return m_index <=> other.m_index; }
+
+    private:
+        const SegmentedVector* m_vec = nullptr;
+        size_type m_index = 0;
+        const ValType* m_ptr = nullptr;
+        const ValType* m_segmentEnd = nullptr;
+
+        void _seat()
+        {
+            ValType* ptr;
+            ValType* segmentEnd;
+            m_vec->_seat(m_index, ptr, segmentEnd);
+            m_ptr = ptr;
+            m_segmentEnd = segmentEnd;
+        }
+    };
+
+    using ReverseIterator = std::reverse_iterator<Iterator>;
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+    // -- Constructors --
+    SegmentedVector() = default;
+    SegmentedVector(std::initializer_list<ValType> list);
+    SegmentedVector(const SegmentedVector& other);
+    SegmentedVector(SegmentedVector&& other) noexcept;
+    SegmentedVector& operator=(const SegmentedVector& other);
+    SegmentedVector& operator=(SegmentedVector&& other) noexcept;
+
+    // -- Destructor --
+    ~SegmentedVector();
+
+    // -- Methods --
+    // - Access -
+    ValType& operator[](size_type index);
+    const ValType& operator[](size_type index) const;
+    ValType& at(size_type index);
+    const ValType& at(size_type index) const;
+
+    ValType& front();
+    const ValType& front() const;
+    ValType& back();
+    const ValType& back() const;
+
+    // Calls `fn(std::span<ValType>)` once per segment that holds elements, in order.
+    // Lets hot loops run over plain contiguous ranges.
+    template<typename Fn>
+    void forEachSegment(Fn&& fn);
+    template<typename Fn>
+    void forEachSegment(Fn&& fn) const;
+
+    // - Iterator methods -
+    Iterator begin() noexcept;
+    ConstIterator begin() const noexcept;
+    Iterator end() noexcept;
+    ConstIterator end() const noexcept;
+
+    ConstIterator cbegin() const noexcept;
+    ConstIterator cend() const noexcept;
+
+    ReverseIterator rbegin() noexcept;
+    ConstReverseIterator rbegin() const noexcept;
+    ReverseIterator rend() noexcept;
+    ConstReverseIterator rend() const noexcept;
+
+    // - Capacity -
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] size_type segmentCount() const noexcept;
+    void reserve(size_type newCapacity);
+    // Frees every segment that holds no element
+    void shrink() noexcept;
+
+    // - Modifiers -
+    void pushBack(const ValType& value);
+    void pushBack(ValType&& value);
+    template<typename... Args>
+    ValType& emplaceBack(Args&&... args);
+    void popBack();
+    // Destroys the elements, keeps the segments
+    void clear() noexcept;
+
+    void swap(SegmentedVector& other) noexcept;
+
+private:
+    ValType* m_segments[Segments::MaxSegments] = {};
+    size_type m_segmentCount = 0; // Allocated segments, always a prefix of the table
+    size_type m_size = 0;
+
+    void _addSegment();
+    void _freeSegments(size_type keep) noexcept;
+
+    // Points `ptr`/`segmentEnd` at element `index`, or nulls both if its segment is not allocated
+    void _seat(size_type index, ValType*& ptr, ValType*& segmentEnd) const noexcept;
+};
+
+} // namespace cads
+
+#include "cads/segmented_vector.tpp"
@@ -0,0 +1,357 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// -- Constructors --
+template <typename ValType, std::size_t BaseSize>
+cads::SegmentedVector<ValType, BaseSize>::SegmentedVector(std::initializer_list<ValType> list)
+{
+    reserve(list.size());
+    for (const ValType& value : list)
+        pushBack(value);
+}
+
+template <typename ValType, std::size_t BaseSize>
+cads::SegmentedVector<ValType, BaseSize>::SegmentedVector(const SegmentedVector& other)
+{
+    reserve(other.m_size);
+
+    try
+    {
+        other.forEachSegment([this](std::span<const ValType> segment) {
+            for (const ValType& value : segment)
+                pushBack(value);
+        });
+    }
+    catch (...)
+    {
+        clear();
+        _freeSegments(0);
+        throw;
+    }
+}
+
+template <typename ValType, std::size_t BaseSize>
+cads::SegmentedVector<ValType, BaseSize>::SegmentedVector(SegmentedVector&& other) noexcept
+{
+    swap(other);
+}
+
+template <typename ValType, std::size_t BaseSize>
+cads::SegmentedVector<ValType, BaseSize>& cads::SegmentedVector<ValType, BaseSize>::operator=(const SegmentedVector& other)
+{
+    if (this != &other)
+    {
+        SegmentedVector temp{other};
+        swap(temp);
+    }
+
+    return *this;
+}
+
+template <typename ValType, std::size_t BaseSize>
+cads::SegmentedVector<ValType, BaseSize>& cads::SegmentedVector<ValType, BaseSize>::operator=(SegmentedVector&& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        _freeSegments(0);
+        swap(other);
+    }
+
+    return *this;
+}
+
+// -- Destructor --
+template <typename ValType, std::size_t BaseSize>
+cads::SegmentedVector<ValType, BaseSize>::~SegmentedVector()
+{
+    clear();
+    _freeSegments(0);
+}
+
+// -- Methods --
+// - Access -
+template <typename ValType, std::size_t BaseSize>
+ValType& cads::SegmentedVector<ValType, BaseSize>::operator[](const size_type index)
+{
+    const auto [segment, offset] = Segments::locate(index);
+    return m_segments[segment][offset];
+}
+
+template <typename ValType, std::size_t BaseSize>
+const ValType& cads::SegmentedVector<ValType, BaseSize>::operator[](const size_type index) const
+{
+    const auto [segment, offset] = Segments::locate(index);
+    return m_segments[segment][offset];
+}
+
+template <typename ValType, std::size_t BaseSize>
+ValType& cads::SegmentedVector<ValType, BaseSize>::at(const size_type index)
+{
+    if (index >= m_size)
+        throw std::out_of_range("SegmentedVector::at: index out of range");
+
+    return (*this)[index];
+}
+
+template <typename ValType, std::size_t BaseSize>
+const ValType& cads::SegmentedVector<ValType, BaseSize>::at(const size_type index) const
+{
+    if (index >= m_size)
+        throw std::out_of_range("SegmentedVector::at: index out of range");
+
+    return (*this)[index];
+}
+
+template <typename ValType, std::size_t BaseSize>
+ValType& cads::SegmentedVector<ValType, BaseSize>::front()
+{
+    assert(!empty() && "SegmentedVector::front: vector is empty");
+    return m_segments[0][0];
+}
+
+template <typename ValType, std::size_t BaseSize>
+const ValType& cads::SegmentedVector<ValType, BaseSize>::front() const
+{
+    assert(!empty() && "SegmentedVector::front: vector is empty");
+    return m_segments[0][0];
+}
+
+template <typename ValType, std::size_t BaseSize>
+ValType& cads::SegmentedVector<ValType, BaseSize>::back()
+{
+    assert(!empty() && "SegmentedVector::back: vector is empty");
+    return (*this)[m_size - 1];
+}
+
+template <typename ValType, std::size_t BaseSize>
+const ValType& cads::SegmentedVector<ValType, BaseSize>::back() const
+{
+    assert(!empty() && "SegmentedVector::back: vector is empty");
+    return (*this)[m_size - 1];
+}
+
+template <typename ValType, std::size_t BaseSize>
+template <typename Fn>
+void cads::SegmentedVector<ValType, BaseSize>::forEachSegment(Fn&& fn)
+{
+    for (size_type segment = 0; Segments::startOf(segment) < m_size; ++segment)
+    {
+        const size_type count = std::min(Segments::capacityOf(segment), m_size - Segments::startOf(segment));
+        fn(std::span<ValType>{m_segments[segment], count});
+    }
+}
+
+template <typename ValType, std::size_t BaseSize>
+template <typename Fn>
+void cads::SegmentedVector<ValType, BaseSize>::forEachSegment(Fn&& fn) const
+{
+    for (size_type segment = 0; Segments::startOf(segment) < m_size; ++segment)
+    {
+        const size_type count = std::min(Segments::capacityOf(segment), m_size - Segments::startOf(segment));
+        fn(std::span<const ValType>{m_segments[segment], count});
+    }
+}
+
+// - Iterator methods -
+template <typename ValType, std::size_t BaseSize>
+typename cads::SegmentedVector<ValType, BaseSize>::Iterator cads::SegmentedVector<ValType, BaseSize>::begin() noexcept
+{
+    return Iterator(this, 0);
+}
+
+template <typename ValType, std::size_t BaseSize>
+typename cads::SegmentedVector<ValType, BaseSize>::ConstIterator cads::SegmentedVector<ValType, BaseSize>::begin() const noexcept
+{
+    return ConstIterator(this, 0);
+}
+
+template <typename ValType, std::size_t BaseSize>
+typename cads::SegmentedVector<ValType, BaseSize>::Iterator cads::SegmentedVector<ValType, BaseSize>::end() noexcept
+{
+    return Iterator(this, m_size);
+}
+
+template <typename ValType, std::size_t BaseSize>
+typename cads::SegmentedVector<ValType, BaseSize>::ConstIterator cads::SegmentedVector<ValType, BaseSize>::end() const noexcept
+{
+    return ConstIterator(this, m_size);
+}
+
+template <typename ValType, std::size_t BaseSize>
+typename cads::SegmentedVector<ValType, BaseSize>::ConstIterator cads::SegmentedVector<ValType, BaseSize>::cbegin() const noexcept
+{
+    return begin();
+}
+
+template <typename ValType, std::size_t BaseSize>
+typename cads::SegmentedVector<ValType, BaseSize>::ConstIterator cads::SegmentedVector<ValType, BaseSize>::cend() const noexcept
+{
+    return end();
+}
+
+template <typename ValType, std::size_t BaseSize>
+typename cads::SegmentedVector<ValType, BaseSize>::ReverseIterator cads::SegmentedVector<ValType, BaseSize>::rbegin() noexcept
+{
+    return ReverseIterator(end());
+}
+
+template <typename ValType, std::size_t BaseSize>
+typename cads::SegmentedVector<ValType, BaseSize>::ConstReverseIterator cads::SegmentedVector<ValType, BaseSize>::rbegin() const noexcept
+{
+    return ConstReverseIterator(end());
+}
+
+template <typename ValType, std::size_t BaseSize>
+typename cads::SegmentedVector<ValType, BaseSize>::ReverseIterator cads::SegmentedVector<ValType, BaseSize>::rend() noexcept
+{
+    return ReverseIterator(begin());
+}
+
+template <typename ValType, std::size_t BaseSize>
+typename cads::SegmentedVector<ValType, BaseSize>::ConstReverseIterator cads::SegmentedVector<ValType, BaseSize>::rend() const noexcept
+{
+    return ConstReverseIterator(begin());
+}
+
+// - Capacity -
+template <typename ValType, std::size_t BaseSize>
+typename cads::SegmentedVector<ValType, BaseSize>::size_type cads::SegmentedVector<ValType, BaseSize>::size() const noexcept
+{
+    return m_size;
+}
+
+template <typename ValType, std::size_t BaseSize>
+typename cads::SegmentedVector<ValType, BaseSize>::size_type cads::SegmentedVector<ValType, BaseSize>::capacity() const noexcept
+{
+    return Segments::startOf(m_segmentCount);
+}
+
+template <typename ValType, std::size_t BaseSize>
+bool cads::SegmentedVector<ValType, BaseSize>::empty() const noexcept
+{
+    return m_size == 0;
+}
+
+template <typename ValType, std::size_t BaseSize>
+typename cads::SegmentedVector<ValType, BaseSize>::size_type cads::SegmentedVector<ValType, BaseSize>::segmentCount() const noexcept
+{
+    return m_segmentCount;
+}
+
+template <typename ValType, std::size_t BaseSize>
+void cads::SegmentedVector<ValType, BaseSize>::reserve(const size_type newCapacity)
+{
+    while (capacity() < newCapacity)
+        _addSegment();
+}
+
+template <typename ValType, std::size_t BaseSize>
+void cads::SegmentedVector<ValType, BaseSize>::shrink() noexcept
+{
+    _freeSegments(Segments::segmentsFor(m_size));
+}
+
+// - Modifiers -
+template <typename ValType, std::size_t BaseSize>
+void cads::SegmentedVector<ValType, BaseSize>::pushBack(const ValType& value)
+{
+    emplaceBack(value);
+}
+
+template <typename ValType, std::size_t BaseSize>
+void cads::SegmentedVector<ValType, BaseSize>::pushBack(ValType&& value)
+{
+    emplaceBack(std::move(value));
+}
+
+template <typename ValType, std::size_t BaseSize>
+template <typename... Args>
+ValType& cads::SegmentedVector<ValType, BaseSize>::emplaceBack(Args&&... args)
+{
+    const auto [segment, offset] = Segments::locate(m_size);
+
+    // Existing elements never move, so `args` may safely refer into this vector
+    if (segment == m_segmentCount)
+        _addSegment();
+
+    ValType* value = new (m_segments[segment] + offset) ValType(std::forward<Args>(args)...);
+    ++m_size;
+    return *value;
+}
+
+template <typename ValType, std::size_t BaseSize>
+void cads::SegmentedVector<ValType, BaseSize>::popBack()
+{
+    assert(!empty() && "SegmentedVector::popBack: vector is empty");
+
+    back().~ValType();
+    --m_size;
+}
+
+template <typename ValType, std::size_t BaseSize>
+void cads::SegmentedVector<ValType, BaseSize>::clear() noexcept
+{
+    if constexpr (!std::is_trivially_destructible_v<ValType>)
+    {
+        forEachSegment([](std::span<ValType> segment) {
+            for (ValType& value : segment)
+                value.~ValType();
+        });
+    }
+
+    m_size = 0;
+}
+
+template <typename ValType, std::size_t BaseSize>
+void cads::SegmentedVector<ValType, BaseSize>::swap(SegmentedVector& other) noexcept
+{
+    std::swap(m_segments, other.m_segments);
+    std::swap(m_segmentCount, other.m_segmentCount);
+    std::swap(m_size, other.m_size);
+}
+
+// -- Private methods --
+template <typename ValType, std::size_t BaseSize>
+void cads::SegmentedVector<ValType, BaseSize>::_addSegment()
+{
+    assert(m_segmentCount < Segments::MaxSegments && "SegmentedVector: segment table exhausted");
+
+    const size_type bytes = Segments::capacityOf(m_segmentCount) * sizeof(ValType);
+    m_segments[m_segmentCount] = static_cast<ValType*>(operator new(bytes));
+    ++m_segmentCount;
+}
+
+template <typename ValType, std::size_t BaseSize>
+void cads::SegmentedVector<ValType, BaseSize>::_freeSegments(const size_type keep) noexcept
+{
+    while (m_segmentCount > keep)
+    {
+        --m_segmentCount;
+        operator delete(m_segments[m_segmentCount]);
+        m_segments[m_segmentCount] = nullptr;
+    }
+}
+
+template <typename ValType, std::size_t BaseSize>
+void cads::SegmentedVector<ValType, BaseSize>::_seat(const size_type index, ValType*& ptr, ValType*& segmentEnd) const noexcept
+{
+    const auto [segment, offset] = Segments::locate(index);
+
+    if (segment < m_segmentCount)
+    {
+        ptr = m_segments[segment] + offset;
+        segmentEnd = m_segments[segment] + Segments::capacityOf(segment);
+    }
+    else
+    {
+        ptr = nullptr;
+        segmentEnd = nullptr;
+    }
+}
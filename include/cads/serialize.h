@@ -0,0 +1,433 @@
+#pragma once
+
+#include "cads/queue.h"
+#include "cads/vector.h"
+#include "cads/detail/posix_file.h"
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace cads
+{
+
+// Binary snapshot layout: a 64-byte header followed by `count` raw elements, in native
+// byte order. The payload starts 64 bytes in, so a page-aligned mapping of the file is
+// suitably aligned for View.
+struct SnapshotHeader
+{
+    static constexpr char Magic[8] = { 'C', 'A', 'D', 'S', 'N', 'A', 'P', '\0' };
+    static constexpr std::uint32_t CurrentVersion = 1;
+
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t elementSize;
+    std::uint64_t count;
+    std::uint32_t alignment;
+    std::uint32_t headerSize;
+    std::uint64_t checksum;     // Over the payload bytes, see detail::SnapshotChecksum
+    std::uint8_t reserved[24];
+};
+
+static_assert(sizeof(SnapshotHeader) == 64 && std::is_trivially_copyable_v<SnapshotHeader>);
+
+namespace detail
+{
+
+// Streaming 64-bit checksum, mixed a word at a time. Feeding the same bytes in any
+// chunking gives the same value.
+class SnapshotChecksum
+{
+public:
+    void update(const void* data, std::size_t length) noexcept
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        m_length += length;
+
+        if (m_pendingSize != 0)
+        {
+            const std::size_t taken = std::min(length, sizeof(m_pending) - m_pendingSize);
+            std::memcpy(m_pending + m_pendingSize, bytes, taken);
+            m_pendingSize += taken;
+            bytes += taken;
+            length -= taken;
+
+            if (m_pendingSize == sizeof(m_pending))
+            {
+                _mix(_load(m_pending));
+                m_pendingSize = 0;
+            }
+        }
+
+        for (; length >= sizeof(std::uint64_t); length -= sizeof(std::uint64_t), bytes += sizeof(std::uint64_t))
+            _mix(_load(bytes));
+
+        // Anything left means the pending bytes were flushed above
+        if (length != 0)
+        {
+            std::memcpy(m_pending, bytes, length);
+            m_pendingSize = length;
+        }
+    }
+
+    [[nodiscard]] std::uint64_t value() const noexcept
+    {
+        SnapshotChecksum copy = *this;
+        if (copy.m_pendingSize != 0)
+        {
+            std::memset(copy.m_pending + copy.m_pendingSize, 0, sizeof(copy.m_pending) - copy.m_pendingSize);
+            copy._mix(_load(copy.m_pending));
+        }
+        copy._mix(m_length);
+        return copy.m_hash;
+    }
+
+private:
+    std::uint64_t m_hash = 0xCBF29CE484222325;
+    std::uint64_t m_length = 0;
+    unsigned char m_pending[8] = {};
+    std::size_t m_pendingSize = 0;
+
+    static std::uint64_t _load(const unsigned char* bytes) noexcept
+    {
+        std::uint64_t word;
+        std::memcpy(&word, bytes, sizeof(word));
+        return word;
+    }
+
+    void _mix(const std::uint64_t word) noexcept
+    {
+        m_hash = std::rotl(m_hash ^ word, 27) * 0x9E3779B97F4A7C15;
+    }
+};
+
+#if defined(IOV_MAX)
+inline constexpr int MaxIovecs = IOV_MAX < 1024 ? IOV_MAX : 1024;
+#else
+inline constexpr int MaxIovecs = 16;
+#endif
+
+// writev() until every byte is out; advances the iovecs past partial writes
+inline void writeAll(const int fd, iovec* iovecs, int count)
+{
+    while (count > 0)
+    {
+        const ssize_t written = ::writev(fd, iovecs, count);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throwErrno("cads::serialize: write failed");
+        }
+
+        auto remaining = static_cast<std::size_t>(written);
+        while (count > 0 && remaining >= iovecs->iov_len)
+        {
+            remaining -= iovecs->iov_len;
+            ++iovecs;
+            --count;
+        }
+        if (count > 0)
+        {
+            iovecs->iov_base = static_cast<char*>(iovecs->iov_base) + remaining;
+            iovecs->iov_len -= remaining;
+        }
+    }
+}
+
+// read() exactly `length` bytes; running out of input is a format error
+inline void readAll(const int fd, void* data, std::size_t length)
+{
+    auto* bytes = static_cast<char*>(data);
+    while (length > 0)
+    {
+        const ssize_t got = ::read(fd, bytes, length);
+        if (got < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throwErrno("cads::deserialize: read failed");
+        }
+        if (got == 0)
+            throw std::runtime_error("cads::deserialize: snapshot is truncated");
+
+        bytes += got;
+        length -= static_cast<std::size_t>(got);
+    }
+}
+
+template<typename Container>
+concept ContiguousSnapshotSource = requires(const Container& container) {
+    { container.data() } -> std::convertible_to<const typename Container::value_type*>;
+    { container.size() } -> std::convertible_to<std::size_t>;
+};
+
+template<typename ValType>
+SnapshotHeader makeHeader(const std::size_t count, const std::uint64_t checksum) noexcept
+{
+    SnapshotHeader header{};
+    std::memcpy(header.magic, SnapshotHeader::Magic, sizeof(header.magic));
+    header.version = SnapshotHeader::CurrentVersion;
+    header.elementSize = sizeof(ValType);
+    header.count = count;
+    header.alignment = alignof(ValType);
+    header.headerSize = sizeof(SnapshotHeader);
+    header.checksum = checksum;
+    return header;
+}
+
+template<typename ValType>
+void validateHeader(const SnapshotHeader& header)
+{
+    if (std::memcmp(header.magic, SnapshotHeader::Magic, sizeof(header.magic)) != 0)
+        throw std::runtime_error("cads::deserialize: not a snapshot");
+    if (header.version != SnapshotHeader::CurrentVersion || header.headerSize != sizeof(SnapshotHeader))
+        throw std::runtime_error("cads::deserialize: unsupported snapshot version");
+    if (header.elementSize != sizeof(ValType) || header.alignment != alignof(ValType))
+        throw std::runtime_error("cads::deserialize: element type mismatch");
+}
+
+// The count comes from the file, so it is checked before it sizes any allocation or read:
+// it must fit size_t bytes and the container, and, where `fd` is a regular file, the bytes
+// actually left in it
+template<typename ValType, typename Container>
+void validateCount(const int fd, const SnapshotHeader& header, const Container& container)
+{
+    if (header.count > std::numeric_limits<std::size_t>::max() / sizeof(ValType))
+        throw std::runtime_error("cads::deserialize: element count too large");
+    if constexpr (requires { container.max_size(); })
+    {
+        if (header.count > container.max_size())
+            throw std::runtime_error("cads::deserialize: element count too large");
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode))
+        return;
+
+    const off_t position = ::lseek(fd, 0, SEEK_CUR);
+    if (position < 0)
+        return;
+
+    const auto remaining = static_cast<std::uint64_t>(std::max<off_t>(info.st_size - position, 0));
+    if (header.count * sizeof(ValType) > remaining)
+        throw std::runtime_error("cads::deserialize: truncated snapshot");
+}
+
+} // namespace detail
+
+// Writes `container` to `fd` as a snapshot. Contiguous containers go out in one writev()
+// straight from data(); node-based ones (List, Queue) are gathered element by element,
+// a batch of iovecs per call. Works on pipes and sockets as well as files.
+template<typename Container>
+    requires std::is_trivially_copyable_v<typename Container::value_type>
+void serialize(const int fd, const Container& container)
+{
+    using ValType = typename Container::value_type;
+
+    if constexpr (detail::ContiguousSnapshotSource<Container>)
+    {
+        const std::size_t bytes = container.size() * sizeof(ValType);
+
+        detail::SnapshotChecksum checksum;
+        checksum.update(container.data(), bytes);
+        SnapshotHeader header = detail::makeHeader<ValType>(container.size(), checksum.value());
+
+        iovec iovecs[2] = {
+            { &header, sizeof(header) },
+            { const_cast<ValType*>(container.data()), bytes }
+        };
+        detail::writeAll(fd, iovecs, bytes == 0 ? 1 : 2);
+    }
+    else
+    {
+        // The header comes first, so checksum in a separate pass rather than seeking back
+        detail::SnapshotChecksum checksum;
+        std::size_t count = 0;
+        for (const ValType& value : container)
+        {
+            checksum.update(&value, sizeof(ValType));
+            ++count;
+        }
+        SnapshotHeader header = detail::makeHeader<ValType>(count, checksum.value());
+
+        iovec iovecs[detail::MaxIovecs];
+        iovecs[0] = { &header, sizeof(header) };
+        int used = 1;
+
+        for (const ValType& value : container)
+        {
+            iovecs[used++] = { const_cast<ValType*>(&value), sizeof(ValType) };
+            if (used == detail::MaxIovecs)
+            {
+                detail::writeAll(fd, iovecs, used);
+                used = 0;
+            }
+        }
+        detail::writeAll(fd, iovecs, used);
+    }
+}
+
+template<typename ValType, typename Container>
+void serialize(const int fd, const Queue<ValType, Container>& queue)
+{
+    serialize(fd, queue.container());
+}
+
+// Creates or truncates the file at `path`
+template<typename Container>
+void serialize(const std::filesystem::path& path, const Container& container)
+{
+    const detail::FileDescriptor file{::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)};
+    if (!file)
+        detail::throwErrno("cads::serialize: cannot open file");
+
+    serialize(file.get(), container);
+}
+
+// Reads one snapshot from `fd` into a new Container. Containers with resize() and data()
+// are filled in place by read(); others receive the elements through pushBack() or push().
+// Format errors, implausible counts and checksum mismatches throw std::runtime_error.
+template<typename Container>
+    requires std::is_trivially_copyable_v<typename Container::value_type>
+Container deserialize(const int fd)
+{
+    using ValType = typename Container::value_type;
+
+    SnapshotHeader header;
+    detail::readAll(fd, &header, sizeof(header));
+    detail::validateHeader<ValType>(header);
+
+    Container container;
+    detail::validateCount<ValType>(fd, header, container);
+    detail::SnapshotChecksum checksum;
+
+    if constexpr (requires(Container& c) { c.resize(std::size_t{}); { c.data() } -> std::convertible_to<ValType*>; })
+    {
+        container.resize(header.count);
+        detail::readAll(fd, container.data(), header.count * sizeof(ValType));
+        checksum.update(container.data(), header.count * sizeof(ValType));
+    }
+    else
+    {
+        constexpr std::size_t ChunkSize = std::max<std::size_t>(1, 4096 / sizeof(ValType));
+        Vector<ValType> chunk(ChunkSize);
+
+        for (std::uint64_t remaining = header.count; remaining > 0;)
+        {
+            const std::size_t batch = std::min<std::uint64_t>(remaining, ChunkSize);
+            detail::readAll(fd, chunk.data(), batch * sizeof(ValType));
+            checksum.update(chunk.data(), batch * sizeof(ValType));
+
+            for (std::size_t i = 0; i < batch; ++i)
+            {
+                if constexpr (requires { container.pushBack(chunk[i]); })
+                    container.pushBack(chunk[i]);
+                else
+                    container.push(chunk[i]);
+            }
+            remaining -= batch;
+        }
+    }
+
+    if (checksum.value() != header.checksum)
+        throw std::runtime_error("cads::deserialize: checksum mismatch");
+
+    return container;
+}
+
+template<typename Container>
+Container deserialize(const std::filesystem::path& path)
+{
+    const detail::FileDescriptor file{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (!file)
+        detail::throwErrno("cads::deserialize: cannot open file");
+
+    return deserialize<Container>(file.get());
+}
+
+
+// Read-only, zero-copy view of a snapshot held in memory, e.g. a mapped file. Construction
+// checks the header, length and alignment in O(1) without touching the payload, so pages
+// are faulted in only when read; verifyChecksum() is the explicit O(n) integrity check.
+// The bytes must outlive the view.
+template<typename ValType>
+    requires std::is_trivially_copyable_v<ValType>
+class View
+{
+public:
+    using ConstIterator = typename Vector<ValType>::ConstIterator;
+
+    using value_type      = ValType;
+    using size_type       = std::size_t;
+    using const_reference = const ValType&;
+    using const_pointer   = const ValType*;
+    using const_iterator  = ConstIterator;
+
+    explicit View(const std::span<const std::byte> snapshot)
+    {
+        if (snapshot.size() < sizeof(SnapshotHeader))
+            throw std::runtime_error("cads::View: snapshot is truncated");
+
+        std::memcpy(&m_header, snapshot.data(), sizeof(m_header));
+        detail::validateHeader<ValType>(m_header);
+
+        if ((snapshot.size() - sizeof(SnapshotHeader)) / sizeof(ValType) < m_header.count)
+            throw std::runtime_error("cads::View: snapshot is truncated");
+
+        const std::byte* payload = snapshot.data() + sizeof(SnapshotHeader);
+        if (reinterpret_cast<std::uintptr_t>(payload) % alignof(ValType) != 0)
+            throw std::runtime_error("cads::View: payload is misaligned");
+
+        m_data = reinterpret_cast<const ValType*>(payload);
+    }
+
+    // - Access -
+    const ValType& operator[](const size_type index) const { return m_data[index]; }
+
+    const ValType& at(const size_type index) const
+    {
+        if (index >= size())
+            throw std::out_of_range("View::at: index out of range");
+        return m_data[index];
+    }
+
+    [[nodiscard]] const ValType* data() const noexcept { return m_data; }
+    [[nodiscard]] std::span<const ValType> span() const noexcept { return { m_data, size() }; }
+    [[nodiscard]] const SnapshotHeader& header() const noexcept { return m_header; }
+
+    ConstIterator begin() const noexcept { return ConstIterator(m_data); }
+    ConstIterator end() const noexcept { return ConstIterator(m_data + size()); }
+
+    // - Capacity -
+    [[nodiscard]] size_type size() const noexcept { return static_cast<size_type>(m_header.count); }
+    [[nodiscard]] bool empty() const noexcept { return m_header.count == 0; }
+
+    [[nodiscard]] bool verifyChecksum() const noexcept
+    {
+        detail::SnapshotChecksum checksum;
+        checksum.update(m_data, size() * sizeof(ValType));
+        return checksum.value() == m_header.checksum;
+    }
+
+private:
+    SnapshotHeader m_header;
+    const ValType* m_data;
+};
+
+} // namespace cads
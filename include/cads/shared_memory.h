@@ -0,0 +1,350 @@
+#pragma once
+
+#include "cads/detail/posix_file.h"
+
+#include <bit>
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cads
+{
+
+// A named POSIX shared memory segment (shm_open + mmap), mapped read-write for the lifetime
+// of the object. The name stays registered until remove() is called, so another process
+// can open() it; unmapping does not destroy the contents.
+class SharedMemory
+{
+public:
+    // Fails if a segment of that name already exists
+    static SharedMemory create(const std::string& name, const std::size_t size)
+    {
+        detail::FileDescriptor file{::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600)};
+        if (!file)
+            detail::throwErrno("SharedMemory::create: shm_open failed");
+
+        if (::ftruncate(file.get(), static_cast<off_t>(size)) != 0)
+        {
+            const int error = errno;
+            ::shm_unlink(name.c_str());
+            throw std::system_error(error, std::generic_category(), "SharedMemory::create: cannot size segment");
+        }
+
+        try
+        {
+            return SharedMemory{file, size, name};
+        }
+        catch (...)
+        {
+            // Otherwise the name stays taken and every retry fails with EEXIST
+            ::shm_unlink(name.c_str());
+            throw;
+        }
+    }
+
+    static SharedMemory open(const std::string& name)
+    {
+        detail::FileDescriptor file{::shm_open(name.c_str(), O_RDWR, 0)};
+        if (!file)
+            detail::throwErrno("SharedMemory::open: shm_open failed");
+
+        struct stat info{};
+        if (::fstat(file.get(), &info) != 0)
+            detail::throwErrno("SharedMemory::open: cannot stat segment");
+
+        return SharedMemory{file, static_cast<std::size_t>(info.st_size), name};
+    }
+
+    // Unregisters the name; existing mappings stay valid. False if there was no such segment.
+    static bool remove(const std::string& name) noexcept
+    {
+        return ::shm_unlink(name.c_str()) == 0;
+    }
+
+    SharedMemory(const SharedMemory&) = delete;
+    SharedMemory& operator=(const SharedMemory&) = delete;
+
+    SharedMemory(SharedMemory&& other) noexcept
+        : m_data{std::exchange(other.m_data, nullptr)}
+        , m_size{std::exchange(other.m_size, 0)}
+        , m_name{std::move(other.m_name)}
+    { }
+
+    SharedMemory& operator=(SharedMemory&& other) noexcept
+    {
+        if (this != &other)
+        {
+            _unmap();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_name = std::move(other.m_name);
+        }
+        return *this;
+    }
+
+    ~SharedMemory()
+    {
+        _unmap();
+    }
+
+    [[nodiscard]] void* data() const noexcept { return m_data; }
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+    [[nodiscard]] const std::string& name() const noexcept { return m_name; }
+
+private:
+    void* m_data;
+    std::size_t m_size;
+    std::string m_name;
+
+    // The descriptor is only needed to establish the mapping
+    SharedMemory(const detail::FileDescriptor& file, const std::size_t size, std::string name)
+        : m_data{nullptr}
+        , m_size{size}
+        , m_name{std::move(name)}
+    {
+        if (size == 0)
+            return;
+
+        void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file.get(), 0);
+        if (address == MAP_FAILED)
+            detail::throwErrno("SharedMemory: mmap failed");
+        m_data = address;
+    }
+
+    void _unmap() noexcept
+    {
+        if (m_data != nullptr)
+            ::munmap(m_data, m_size);
+        m_data = nullptr;
+    }
+};
+
+
+// Process-shared allocator placed at the start of a memory region, normally a SharedMemory
+// segment. All bookkeeping is stored as offsets from the arena itself, so every process can
+// attach() at whatever address its mapping got. Blocks (request plus a header) are rounded up
+// to a power of two and recycled through one free list per size class, guarded by a robust
+// PTHREAD_PROCESS_SHARED mutex: a process dying inside the arena at worst leaks the block it
+// was taking, and the next locker carries on. Objects built here must not hold raw pointers;
+// use OffsetPtr instead.
+class SharedArena
+{
+public:
+    // A cache line, so shared atomics can be given a line of their own
+    static constexpr std::size_t MaxAlignment = 64;
+
+    // Formats `size` bytes at `memory` (which must be MaxAlignment-aligned) as an empty arena
+    static SharedArena& create(void* memory, const std::size_t size)
+    {
+        assert(reinterpret_cast<std::uintptr_t>(memory) % MaxAlignment == 0 && "SharedArena::create: misaligned memory");
+        if (size < sizeof(SharedArena) + MaxAlignment)
+            throw std::invalid_argument("SharedArena::create: region too small");
+
+        return *new (memory) SharedArena{size};
+    }
+
+    // The arena another process created in the same segment
+    static SharedArena& attach(void* memory)
+    {
+        auto* arena = static_cast<SharedArena*>(memory);
+        if (arena->m_magic != Magic)
+            throw std::runtime_error("SharedArena::attach: no arena at this address");
+        return *arena;
+    }
+
+    static SharedArena& create(const SharedMemory& memory) { return create(memory.data(), memory.size()); }
+    static SharedArena& attach(const SharedMemory& memory) { return attach(memory.data()); }
+
+    // Bytes a request for `bytes` actually gets: the rest of its power-of-two block after the
+    // header. Growable containers size themselves to this so the rounding is not wasted.
+    static std::size_t usableSize(const std::size_t bytes) noexcept
+    {
+        return (std::size_t{1} << _sizeClassFor(bytes)) - sizeof(BlockHeader);
+    }
+
+    SharedArena(const SharedArena&) = delete;
+    SharedArena& operator=(const SharedArena&) = delete;
+
+    // Throws std::bad_alloc when the region is exhausted
+    void* allocate(const std::size_t bytes, [[maybe_unused]] const std::size_t alignment = alignof(std::max_align_t))
+    {
+        assert(alignment <= MaxAlignment && "SharedArena::allocate: alignment not supported");
+        if (bytes > m_size)
+            throw std::bad_alloc{};
+
+        const unsigned sizeClass = _sizeClassFor(bytes);
+        std::size_t offset;
+        {
+            const Lock lock{m_mutex};
+
+            offset = m_freeLists[sizeClass];
+            if (offset != 0)
+            {
+                m_freeLists[sizeClass] = _header(offset)->next;
+            }
+            else
+            {
+                const std::size_t blockSize = std::size_t{1} << sizeClass;
+                if (blockSize > m_size - m_top)
+                    throw std::bad_alloc{};
+
+                offset = m_top;
+                m_top += blockSize;
+            }
+        }
+
+        _header(offset)->sizeClass = sizeClass;
+        return reinterpret_cast<std::byte*>(this) + offset + sizeof(BlockHeader);
+    }
+
+    void deallocate(void* ptr) noexcept
+    {
+        if (ptr == nullptr)
+            return;
+
+        const std::size_t offset = static_cast<std::size_t>(static_cast<std::byte*>(ptr) - reinterpret_cast<std::byte*>(this)) - sizeof(BlockHeader);
+        BlockHeader* header = _header(offset);
+
+        const Lock lock{m_mutex};
+        header->next = m_freeLists[header->sizeClass];
+        m_freeLists[header->sizeClass] = offset;
+    }
+
+    template<typename T, typename... Args>
+    T* construct(Args&&... args)
+    {
+        static_assert(alignof(T) <= MaxAlignment, "SharedArena: over-aligned type");
+
+        void* memory = allocate(sizeof(T), alignof(T));
+        try
+        {
+            return new (memory) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            deallocate(memory);
+            throw;
+        }
+    }
+
+    template<typename T>
+    void destroy(T* object) noexcept
+    {
+        if (object == nullptr)
+            return;
+
+        object->~T();
+        deallocate(object);
+    }
+
+    // One well-known object per arena through which other processes find the rest
+    void setRoot(void* object) noexcept
+    {
+        m_root = object == nullptr ? 0 : static_cast<std::size_t>(static_cast<std::byte*>(object) - reinterpret_cast<std::byte*>(this));
+    }
+
+    template<typename T>
+    [[nodiscard]] T* root() const noexcept
+    {
+        return m_root == 0 ? nullptr : reinterpret_cast<T*>(const_cast<std::byte*>(reinterpret_cast<const std::byte*>(this)) + m_root);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+
+    // Tears the arena down once no process uses it any more, typically right before
+    // SharedMemory::remove(): destroys the mutex and makes later attach() calls fail
+    void close() noexcept
+    {
+        m_magic = 0;
+        pthread_mutex_destroy(&m_mutex);
+    }
+
+    // Bytes never handed out yet; freed blocks are not counted
+    [[nodiscard]] std::size_t unused() const noexcept
+    {
+        const Lock lock{m_mutex};
+        return m_size - m_top;
+    }
+
+private:
+    static constexpr std::uint64_t Magic = 0x4341445341524E41; // "CADSARNA"
+    static constexpr unsigned MinSizeClass = 7;                  // 128-byte blocks, half of it header
+    static constexpr unsigned SizeClasses = 64;
+
+    struct alignas(MaxAlignment) BlockHeader
+    {
+        std::size_t sizeClass;
+        std::size_t next;       // Free-list link while the block is free
+    };
+
+    // Every critical section publishes its change with a single store, so whatever a dead
+    // owner left behind is consistent and the mutex can simply be marked usable again
+    class Lock
+    {
+    public:
+        explicit Lock(pthread_mutex_t& mutex) noexcept : m_mutex{mutex}
+        {
+            [[maybe_unused]] int result = pthread_mutex_lock(&m_mutex);
+            if (result == EOWNERDEAD)
+                result = pthread_mutex_consistent(&m_mutex);
+            assert(result == 0 && "SharedArena: cannot lock the arena mutex");
+        }
+
+        ~Lock() { pthread_mutex_unlock(&m_mutex); }
+
+        Lock(const Lock&) = delete;
+        Lock& operator=(const Lock&) = delete;
+
+    private:
+        pthread_mutex_t& m_mutex;
+    };
+
+    std::uint64_t m_magic;
+    std::size_t m_size;
+    std::size_t m_top;
+    std::size_t m_root;
+    std::size_t m_freeLists[SizeClasses];
+    mutable pthread_mutex_t m_mutex;
+
+    explicit SharedArena(const std::size_t size)
+        : m_size{size}
+        , m_top{(sizeof(SharedArena) + MaxAlignment - 1) / MaxAlignment * MaxAlignment}
+        , m_root{0}
+        , m_freeLists{}
+    {
+        pthread_mutexattr_t attributes;
+        pthread_mutexattr_init(&attributes);
+        pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+        pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+        pthread_mutex_init(&m_mutex, &attributes);
+        pthread_mutexattr_destroy(&attributes);
+
+        m_magic = Magic;
+    }
+
+    static unsigned _sizeClassFor(const std::size_t bytes) noexcept
+    {
+        const std::size_t needed = bytes + sizeof(BlockHeader);
+        const auto sizeClass = static_cast<unsigned>(std::bit_width(needed - 1));
+        return sizeClass < MinSizeClass ? MinSizeClass : sizeClass;
+    }
+
+    BlockHeader* _header(const std::size_t offset) noexcept
+    {
+        return reinterpret_cast<BlockHeader*>(reinterpret_cast<std::byte*>(this) + offset);
+    }
+};
+
+} // namespace cads
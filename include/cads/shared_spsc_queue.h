@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <new>
+#include <optional>
+#include <type_traits>
+
+namespace cads
+{
+
+// Bounded single-producer/single-consumer ring with its slots stored inline, so the whole
+// queue is one pointer-free block that can sit in shared memory (e.g. built with
+// SharedArena::construct) and be used by two processes at different mapping addresses.
+// Each side keeps a cached copy of the other side's index and only reloads it when the
+// ring looks full (or empty), so the shared cache lines are touched once per lap, not per item.
+template<typename ValType, std::size_t Capacity>
+class SharedSpscQueue
+{
+    static_assert(std::is_trivially_copyable_v<ValType>, "SharedSpscQueue: ValType must be trivially copyable");
+    static_assert(std::has_single_bit(Capacity), "SharedSpscQueue: Capacity must be a power of two");
+    static_assert(std::atomic<std::size_t>::is_always_lock_free,
+                  "SharedSpscQueue: cross-process use needs address-free atomics");
+
+public:
+    using value_type = ValType;
+    using size_type  = std::size_t;
+
+    SharedSpscQueue() noexcept = default;
+
+    SharedSpscQueue(const SharedSpscQueue&) = delete;
+    SharedSpscQueue& operator=(const SharedSpscQueue&) = delete;
+
+    // - Producer -
+    // False if the queue is full
+    bool tryPush(const ValType& value) noexcept
+    {
+        const size_type tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead == Capacity)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead == Capacity)
+                return false;
+        }
+
+        new (_slot(tail)) ValType(value);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // - Consumer -
+    // Empty optional if there is nothing to pop
+    std::optional<ValType> tryPop() noexcept
+    {
+        const size_type head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cachedTail)
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cachedTail)
+                return std::nullopt;
+        }
+
+        std::optional<ValType> value{*std::launder(reinterpret_cast<ValType*>(_slot(head)))};
+        m_head.store(head + 1, std::memory_order_release);
+        return value;
+    }
+
+    // - Observers (approximate while the other side is active) -
+    [[nodiscard]] size_type size() const noexcept
+    {
+        const size_type head = m_head.load(std::memory_order_acquire);
+        return m_tail.load(std::memory_order_acquire) - head;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    [[nodiscard]] static constexpr size_type capacity() noexcept
+    {
+        return Capacity;
+    }
+
+private:
+    static constexpr std::size_t CacheLine = 64;
+
+    // Producer line: its index plus its view of the consumer's
+    alignas(CacheLine) std::atomic<size_type> m_tail{0};
+    size_type m_cachedHead = 0;
+
+    // Consumer line
+    alignas(CacheLine) std::atomic<size_type> m_head{0};
+    size_type m_cachedTail = 0;
+
+    alignas(CacheLine) alignas(ValType) unsigned char m_storage[Capacity * sizeof(ValType)];
+
+    unsigned char* _slot(const size_type index) noexcept
+    {
+        return m_storage + (index & (Capacity - 1)) * sizeof(ValType);
+    }
+};
+
+} // namespace cads
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "cads/offset_ptr.h"
+#include "cads/shared_memory.h"
+#include "cads/vector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace cads
+{
+
+// Vector whose header and elements both live in a SharedArena. Every internal pointer is an
+// OffsetPtr, so any process that maps the segment can use it in place, whatever address its
+// mapping got. Construct it inside the arena (`arena.construct<SharedVector<T>>(arena)`) and
+// publish it with SharedArena::setRoot() or through another shared object.
+// Not synchronised: hand it over between processes with a queue or some other protocol.
+template<typename ValType>
+class SharedVector
+{
+    static_assert(std::is_trivially_copyable_v<ValType>, "SharedVector: ValType must be trivially copyable");
+
+public:
+    using Iterator             = typename Vector<ValType>::Iterator;
+    using ConstIterator        = typename Vector<ValType>::ConstIterator;
+    using ReverseIterator      = std::reverse_iterator<Iterator>;
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+    using value_type      = ValType;
+    using size_type       = std::size_t;
+    using reference       = ValType&;
+    using const_reference = const ValType&;
+    using iterator        = Iterator;
+    using const_iterator  = ConstIterator;
+
+    // -- Constructors --
+    explicit SharedVector(SharedArena& arena) noexcept
+        : m_arena{&arena}
+    { }
+
+    // Pinned to its place in the segment
+    SharedVector(const SharedVector&) = delete;
+    SharedVector& operator=(const SharedVector&) = delete;
+
+    // -- Destructor --
+    ~SharedVector()
+    {
+        m_arena->deallocate(m_data.get());
+    }
+
+    // -- Methods --
+    // - Access -
+    ValType& operator[](const size_type index) { return m_data[index]; }
+    const ValType& operator[](const size_type index) const { return m_data[index]; }
+
+    ValType& at(const size_type index)
+    {
+        if (index >= m_size)
+            throw std::out_of_range("SharedVector::at: index out of range");
+        return m_data[index];
+    }
+
+    const ValType& at(const size_type index) const
+    {
+        if (index >= m_size)
+            throw std::out_of_range("SharedVector::at: index out of range");
+        return m_data[index];
+    }
+
+    ValType& back()
+    {
+        assert(!empty() && "SharedVector::back: vector is empty");
+        return m_data[m_size - 1];
+    }
+
+    const ValType& back() const
+    {
+        assert(!empty() && "SharedVector::back: vector is empty");
+        return m_data[m_size - 1];
+    }
+
+    ValType* data() noexcept { return m_data.get(); }
+    const ValType* data() const noexcept { return m_data.get(); }
+
+    // - Iterator methods -
+    Iterator begin() noexcept { return Iterator(data()); }
+    ConstIterator begin() const noexcept { return ConstIterator(data()); }
+    Iterator end() noexcept { return Iterator(data() + m_size); }
+    ConstIterator end() const noexcept { return ConstIterator(data() + m_size); }
+
+    ReverseIterator rbegin() noexcept { return ReverseIterator(end()); }
+    ConstReverseIterator rbegin() const noexcept { return ConstReverseIterator(end()); }
+    ReverseIterator rend() noexcept { return ReverseIterator(begin()); }
+    ConstReverseIterator rend() const noexcept { return ConstReverseIterator(begin()); }
+
+    // - Capacity -
+    [[nodiscard]] size_type size() const noexcept { return m_size; }
+    [[nodiscard]] size_type capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    void reserve(const size_type newCapacity)
+    {
+        if (newCapacity > m_capacity)
+            _reallocate(newCapacity);
+    }
+
+    void resize(const size_type newSize, const ValType& value = ValType{})
+    {
+        const ValType copy = value;
+        if (newSize > m_capacity)
+            _reallocate(newSize);
+
+        std::fill(data() + std::min(m_size, newSize), data() + newSize, copy);
+        m_size = newSize;
+    }
+
+    // - Modifiers -
+    void pushBack(const ValType& value)
+    {
+        // Copy first: `value` may be an element about to be moved by the reallocation
+        const ValType copy = value;
+        if (m_size == m_capacity)
+            _reallocate(std::max<size_type>(m_capacity * 2, 4));
+
+        m_data[m_size] = copy;
+        ++m_size;
+    }
+
+    void popBack()
+    {
+        assert(!empty() && "SharedVector::popBack: vector is empty");
+        --m_size;
+    }
+
+    void clear() noexcept
+    {
+        m_size = 0;
+    }
+
+private:
+    OffsetPtr<SharedArena> m_arena;
+    OffsetPtr<ValType> m_data;
+    size_type m_size = 0;
+    size_type m_capacity = 0;
+
+    // Takes up the whole arena block, so power-of-two sizes don't double for the block header
+    void _reallocate(const size_type requested)
+    {
+        const size_type newCapacity = SharedArena::usableSize(requested * sizeof(ValType)) / sizeof(ValType);
+        auto* newData = static_cast<ValType*>(m_arena->allocate(newCapacity * sizeof(ValType), alignof(ValType)));
+        if (m_size != 0)
+            std::memcpy(newData, data(), m_size * sizeof(ValType));
+
+        m_arena->deallocate(data());
+        m_data = newData;
+        m_capacity = newCapacity;
+    }
+};
+
+} // namespace cads
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "cads/queue.h"
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace cads
+{
+
+// Fire-and-forget coroutine: starts suspended, is handed to an executor with spawn()
+// and frees its own frame when it finishes.
+class DetachedTask
+{
+public:
+    struct promise_type
+    {
+        DetachedTask get_return_object() noexcept
+        {
+            return DetachedTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    DetachedTask(DetachedTask&& other) noexcept
+        : m_handle{std::exchange(other.m_handle, {})}
+    { }
+
+    DetachedTask& operator=(DetachedTask&&) = delete;
+
+    // A task that was never spawned has not started yet and is simply dropped
+    ~DetachedTask()
+    {
+        if (m_handle)
+            m_handle.destroy();
+    }
+
+private:
+    friend class SingleThreadExecutor;
+
+    std::coroutine_handle<> m_handle;
+
+    explicit DetachedTask(const std::coroutine_handle<> handle) noexcept
+        : m_handle{handle}
+    { }
+};
+
+// Runs coroutines on the calling thread of run(), in FIFO order. Not thread-safe; meant for
+// tests and single-threaded event loops.
+class SingleThreadExecutor
+{
+public:
+    class YieldAwaiter
+    {
+    public:
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(const std::coroutine_handle<> handle) { m_executor->post(handle); }
+        void await_resume() const noexcept {}
+
+    private:
+        friend class SingleThreadExecutor;
+
+        SingleThreadExecutor* m_executor;
+
+        explicit YieldAwaiter(SingleThreadExecutor* executor) noexcept
+            : m_executor{executor}
+        { }
+    };
+
+    SingleThreadExecutor() = default;
+
+    SingleThreadExecutor(const SingleThreadExecutor&) = delete;
+    SingleThreadExecutor& operator=(const SingleThreadExecutor&) = delete;
+
+    // Frames still queued are destroyed without running
+    ~SingleThreadExecutor()
+    {
+        while (!m_ready.empty())
+        {
+            m_ready.front().destroy();
+            m_ready.pop();
+        }
+    }
+
+
+    void spawn(DetachedTask task)
+    {
+        post(std::exchange(task.m_handle, {}));
+    }
+
+    void post(const std::coroutine_handle<> handle)
+    {
+        m_ready.push(handle);
+    }
+
+    // `co_await executor.yield()` requeues the current coroutine behind the ready ones
+    [[nodiscard]] YieldAwaiter yield() noexcept
+    {
+        return YieldAwaiter{this};
+    }
+
+    // Resumes ready coroutines until none is left. Coroutines suspended elsewhere (e.g. on a
+    // Channel) are not tracked; they are queued again once whatever they wait on post()s them.
+    void run()
+    {
+        while (!m_ready.empty())
+        {
+            const std::coroutine_handle<> handle = m_ready.front();
+            m_ready.pop();
+            handle.resume();
+        }
+    }
+
+private:
+    Queue<std::coroutine_handle<>> m_ready;
+};
+
+} // namespace cads
@@ -0,0 +1,229 @@
+#pragma once
+
+#include "cads/vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace cads
+{
+
+// Unordered container addressed by generational handles. Values sit densely packed in a
+// Vector (erase moves the last value into the hole), and a slot table maps each handle to
+// the value's current position. Erasing bumps the slot's generation, so stale handles are
+// detected instead of silently aliasing a newer value; freed slots are reused LIFO.
+// Insert, erase and lookup are O(1); iteration runs over the dense values in no particular order.
+template<typename ValType>
+class SlotMap
+{
+public:
+    struct Handle
+    {
+        std::uint32_t index = UINT32_MAX;
+        std::uint32_t generation = 0;
+
+        bool operator==(const Handle&) const = default;
+    };
+
+    using value_type      = ValType;
+    using size_type       = std::size_t;
+    using reference       = ValType&;
+    using const_reference = const ValType&;
+    using iterator        = typename Vector<ValType>::Iterator;
+    using const_iterator  = typename Vector<ValType>::ConstIterator;
+
+
+    // - Capacity -
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return m_values.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_values.empty();
+    }
+
+    void reserve(const size_type count)
+    {
+        m_values.reserve(count);
+        m_denseToSlot.reserve(count);
+        m_slots.reserve(count);
+    }
+
+
+    // - Modifiers -
+    Handle insert(const ValType& value)
+    {
+        return emplace(value);
+    }
+
+    Handle insert(ValType&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    template<typename... Args>
+    Handle emplace(Args&&... args)
+    {
+        const std::uint32_t slotIndex = m_freeHead != NoSlot ? m_freeHead : static_cast<std::uint32_t>(m_slots.size());
+        assert(slotIndex != NoSlot && "SlotMap: too many slots");
+
+        // Grow the index tables first: once the value is in, nothing may throw or it would
+        // be left without a slot
+        _reserveOneMore(m_denseToSlot);
+        if (slotIndex == m_slots.size())
+            _reserveOneMore(m_slots);
+
+        m_values.pushBack(ValType(std::forward<Args>(args)...));
+        m_denseToSlot.pushBack(slotIndex);
+
+        if (slotIndex == m_slots.size())
+            m_slots.pushBack(Slot{0, 0});
+        else
+            m_freeHead = m_slots[slotIndex].target;
+
+        Slot& slot = m_slots[slotIndex];
+        slot.target = static_cast<std::uint32_t>(m_values.size() - 1);
+
+        return Handle{slotIndex, slot.generation};
+    }
+
+    // False if the handle is stale
+    bool erase(const Handle handle)
+    {
+        if (!contains(handle))
+            return false;
+
+        Slot& slot = m_slots[handle.index];
+        const std::uint32_t dense = slot.target;
+        const std::uint32_t last = static_cast<std::uint32_t>(m_values.size() - 1);
+
+        // Swap-and-pop: only the last value moves
+        if (dense != last)
+        {
+            m_values[dense] = std::move(m_values[last]);
+            m_denseToSlot[dense] = m_denseToSlot[last];
+            m_slots[m_denseToSlot[dense]].target = dense;
+        }
+        m_values.popBack();
+        m_denseToSlot.popBack();
+
+        ++slot.generation;
+        slot.target = m_freeHead;
+        m_freeHead = handle.index;
+
+        return true;
+    }
+
+    // Invalidates every handle
+    void clear()
+    {
+        for (const std::uint32_t slotIndex : m_denseToSlot)
+        {
+            Slot& slot = m_slots[slotIndex];
+            ++slot.generation;
+            slot.target = m_freeHead;
+            m_freeHead = slotIndex;
+        }
+
+        m_values.clear();
+        m_denseToSlot.clear();
+    }
+
+
+    // - Lookup -
+    [[nodiscard]] bool contains(const Handle handle) const noexcept
+    {
+        return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation
+            && _isLive(handle.index);
+    }
+
+    // nullptr if the handle is stale
+    ValType* get(const Handle handle) noexcept
+    {
+        return contains(handle) ? &m_values[m_slots[handle.index].target] : nullptr;
+    }
+
+    const ValType* get(const Handle handle) const noexcept
+    {
+        return contains(handle) ? &m_values[m_slots[handle.index].target] : nullptr;
+    }
+
+    ValType& operator[](const Handle handle)
+    {
+        assert(contains(handle) && "SlotMap::operator[]: stale handle");
+        return m_values[m_slots[handle.index].target];
+    }
+
+    const ValType& operator[](const Handle handle) const
+    {
+        assert(contains(handle) && "SlotMap::operator[]: stale handle");
+        return m_values[m_slots[handle.index].target];
+    }
+
+    ValType& at(const Handle handle)
+    {
+        if (!contains(handle))
+            throw std::out_of_range("SlotMap::at: stale handle");
+        return m_values[m_slots[handle.index].target];
+    }
+
+    const ValType& at(const Handle handle) const
+    {
+        if (!contains(handle))
+            throw std::out_of_range("SlotMap::at: stale handle");
+        return m_values[m_slots[handle.index].target];
+    }
+
+    // Handle of the value at position `denseIndex` of the iteration order
+    [[nodiscard]] Handle handleAt(const size_type denseIndex) const
+    {
+        const std::uint32_t slotIndex = m_denseToSlot[denseIndex];
+        return Handle{slotIndex, m_slots[slotIndex].generation};
+    }
+
+
+    // - Dense iteration -
+    iterator begin() noexcept { return m_values.begin(); }
+    const_iterator begin() const noexcept { return m_values.begin(); }
+    iterator end() noexcept { return m_values.end(); }
+    const_iterator end() const noexcept { return m_values.end(); }
+
+    ValType* data() noexcept { return m_values.data(); }
+    const ValType* data() const noexcept { return m_values.data(); }
+
+private:
+    static constexpr std::uint32_t NoSlot = UINT32_MAX;
+
+    struct Slot
+    {
+        std::uint32_t target;     // Dense index while live, next free slot while free
+        std::uint32_t generation;
+    };
+
+    Vector<ValType> m_values;
+    Vector<std::uint32_t> m_denseToSlot;
+    Vector<Slot> m_slots;
+    std::uint32_t m_freeHead = NoSlot;
+
+    // A free slot's `target` is a free-list link, so check the back-pointer as well
+    bool _isLive(const std::uint32_t slotIndex) const noexcept
+    {
+        const std::uint32_t dense = m_slots[slotIndex].target;
+        return dense < m_denseToSlot.size() && m_denseToSlot[dense] == slotIndex;
+    }
+
+    // Same doubling as pushBack, done ahead of time
+    template<typename T>
+    static void _reserveOneMore(Vector<T>& vec)
+    {
+        if (vec.size() == vec.capacity())
+            vec.reserve(vec.capacity() == 0 ? 1 : vec.capacity() * 2);
+    }
+};
+
+} // namespace cads
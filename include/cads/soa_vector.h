@@ -0,0 +1,424 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace cads
+{
+
+// Structure-of-arrays vector: element i is the row (column<0>[i], column<1>[i], ...), and
+// every column is its own contiguous array. All columns live in one allocation, each
+// starting on a 64-byte boundary, and share one size and capacity. Loops over data<I>()
+// touch only the bytes of that field and vectorize like loops over a plain array.
+template<typename... Ts>
+class SoAVector
+{
+    static_assert(sizeof...(Ts) > 0, "SoAVector needs at least one column");
+    static_assert(((alignof(Ts) <= 64) && ...), "SoAVector columns are aligned to 64 bytes at most");
+
+    using Indices = std::index_sequence_for<Ts...>;
+
+public:
+    class Iterator;
+    class ConstIterator;
+
+    using value_type      = std::tuple<Ts...>;
+    using size_type       = std::size_t;
+    using reference       = std::tuple<Ts&...>;
+    using const_reference = std::tuple<const Ts&...>;
+    using iterator        = Iterator;
+    using const_iterator  = ConstIterator;
+
+    template<std::size_t I>
+    using column_type = std::tuple_element_t<I, value_type>;
+
+    static constexpr size_type ColumnCount = sizeof...(Ts);
+    static constexpr size_type ColumnAlignment = 64;
+
+    // -- Iterators --
+    // Zip iterators: dereferencing yields a tuple of references into every column.
+    // They support random-access arithmetic, but the proxy reference makes them input
+    // iterators as far as the standard categories go.
+    class Iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = std::tuple<Ts...>;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = std::tuple<Ts&...>;
+
+        friend class ConstIterator;
+
+        Iterator() = default;
+        Iterator(SoAVector* vec, size_type index) : m_vec(vec), m_index(index) {}
+
+        reference operator*() const { return (*m_vec)[m_index]; }
+
+        Iterator& operator++() { ++m_index; return *this; }
+        Iterator operator++(int) { auto temp = *this; ++m_index; return temp; }
+        Iterator& operator--() { --m_index; return *this; }
+        Iterator operator--(int) { auto temp = *this; --m_index; return temp; }
+
+        Iterator& operator+=(std::ptrdiff_t n) { m_index += n; return *this; }
+        Iterator& operator-=(std::ptrdiff_t n) { m_index -= n; return *this; }
+
+        Iterator operator+(std::ptrdiff_t n) const { return Iterator(m_vec, m_index + n); }
+        Iterator operator-(std::ptrdiff_t n) const { return Iterator(m_vec, m_index - n); }
+        std::ptrdiff_t operator-(const Iterator& other) const
+        {
+            return static_cast<std::ptrdiff_t>(m_index) - static_cast<std::ptrdiff_t>(other.m_index);
+        }
+
+        reference operator[](std::ptrdiff_t n) const { return (*m_vec)[m_index + n]; }
+
+        bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+        auto operator<=>(const Iterator& other) const { return m_index <=> other.m_index; }
+
+    private:
+        SoAVector* m_vec = nullptr;
+        size_type m_index = 0;
+    };
+
+    class ConstIterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type        = std::tuple<Ts...>;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = std::tuple<const Ts&...>;
+
+        ConstIterator() = default;
+        ConstIterator(const SoAVector* vec, size_type index) : m_vec(vec), m_index(index) {}
+
+        ConstIterator(const Iterator& it) : m_vec(it.m_vec), m_index(it.m_index) {}
+
+        reference operator*() const { return (*m_vec)[m_index]; }
+
+        ConstIterator& operator++() { ++m_index; return *this; }
+        ConstIterator operator++(int) { auto temp = *this; ++m_index; return temp; }
+        ConstIterator& operator--() { --m_index; return *this; }
+        ConstIterator operator--(int) { auto temp = *this; --m_index; return temp; }
+
+        ConstIterator& operator+=(std::ptrdiff_t n) { m_index += n; return *this; }
+        ConstIterator& operator-=(std::ptrdiff_t n) { m_index -= n; return *this; }
+
+        ConstIterator operator+(std::ptrdiff_t n) const { return ConstIterator(m_vec, m_index + n); }
+        ConstIterator operator-(std::ptrdiff_t n) const { return ConstIterator(m_vec, m_index - n); }
+        std::ptrdiff_t operator-(const ConstIterator& other) const
+        {
+            return static_cast<std::ptrdiff_t>(m_index) - static_cast<std::ptrdiff_t>(other.m_index);
+        }
+
+        reference operator[](std::ptrdiff_t n) const { return (*m_vec)[m_index + n]; }
+
+        bool operator==(const ConstIterator& other) const { return m_index == other.m_index; }
+        auto operator<=>(const ConstIterator& other) const { return m_index <=> other.m_index; }
+
+    private:
+        const SoAVector* m_vec = nullptr;
+        size_type m_index = 0;
+    };
+
+    // -- Constructors --
+    SoAVector() = default;
+
+    SoAVector(const SoAVector& other)
+    {
+        reserve(other.m_size);
+        for (size_type row = 0; row < other.m_size; ++row)
+            pushBack(other.get(row));
+    }
+
+    SoAVector(SoAVector&& other) noexcept
+    {
+        swap(other);
+    }
+
+    SoAVector& operator=(const SoAVector& other)
+    {
+        if (this != &other)
+        {
+            SoAVector temp{other};
+            swap(temp);
+        }
+        return *this;
+    }
+
+    SoAVector& operator=(SoAVector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            SoAVector temp{std::move(other)};
+            swap(temp);
+        }
+        return *this;
+    }
+
+    // -- Destructor --
+    ~SoAVector()
+    {
+        clear();
+        _deallocate(m_storage);
+    }
+
+    // -- Methods --
+    // - Access -
+    reference operator[](const size_type row)
+    {
+        return _row(row, Indices{});
+    }
+
+    const_reference operator[](const size_type row) const
+    {
+        return _row(row, Indices{});
+    }
+
+    reference at(const size_type row)
+    {
+        if (row >= m_size)
+            throw std::out_of_range("SoAVector::at: index out of range");
+
+        return (*this)[row];
+    }
+
+    const_reference at(const size_type row) const
+    {
+        if (row >= m_size)
+            throw std::out_of_range("SoAVector::at: index out of range");
+
+        return (*this)[row];
+    }
+
+    // Copy of a whole row
+    value_type get(const size_type row) const
+    {
+        return value_type{(*this)[row]};
+    }
+
+    reference front()
+    {
+        assert(!empty() && "SoAVector::front: vector is empty");
+        return (*this)[0];
+    }
+
+    reference back()
+    {
+        assert(!empty() && "SoAVector::back: vector is empty");
+        return (*this)[m_size - 1];
+    }
+
+    template<std::size_t I>
+    column_type<I>* data() noexcept
+    {
+        return std::get<I>(m_columns);
+    }
+
+    template<std::size_t I>
+    const column_type<I>* data() const noexcept
+    {
+        return std::get<I>(m_columns);
+    }
+
+    template<std::size_t I>
+    std::span<column_type<I>> column() noexcept
+    {
+        return {data<I>(), m_size};
+    }
+
+    template<std::size_t I>
+    std::span<const column_type<I>> column() const noexcept
+    {
+        return {data<I>(), m_size};
+    }
+
+    // - Iterator methods -
+    Iterator begin() noexcept { return Iterator(this, 0); }
+    ConstIterator begin() const noexcept { return ConstIterator(this, 0); }
+    Iterator end() noexcept { return Iterator(this, m_size); }
+    ConstIterator end() const noexcept { return ConstIterator(this, m_size); }
+
+    ConstIterator cbegin() const noexcept { return begin(); }
+    ConstIterator cend() const noexcept { return end(); }
+
+    // - Capacity -
+    [[nodiscard]] size_type size() const noexcept { return m_size; }
+    [[nodiscard]] size_type capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    void reserve(const size_type newCapacity)
+    {
+        if (newCapacity > m_capacity)
+            _reallocate(newCapacity);
+    }
+
+    // - Modifiers -
+    void pushBack(const value_type& row)
+    {
+        std::apply([this](const Ts&... fields) { emplaceBack(fields...); }, row);
+    }
+
+    void pushBack(value_type&& row)
+    {
+        std::apply([this](Ts&... fields) { emplaceBack(std::move(fields)...); }, row);
+    }
+
+    // One constructor argument per column
+    template<typename... Args>
+    void emplaceBack(Args&&... fields)
+    {
+        static_assert(sizeof...(Args) == ColumnCount, "emplaceBack takes one value per column");
+
+        if (m_size < m_capacity)
+        {
+            _constructRow(m_size, Indices{}, std::forward<Args>(fields)...);
+            ++m_size;
+            return;
+        }
+
+        // The new row is built first, while `fields` may still refer to rows of this vector
+        SoAVector grown;
+        grown._allocate(m_capacity == 0 ? 8 : m_capacity * 2, Indices{});
+        grown._constructRow(m_size, Indices{}, std::forward<Args>(fields)...);
+        try
+        {
+            _relocateInto(grown, Indices{});
+        }
+        catch (...)
+        {
+            grown._destroyRow(m_size, ColumnCount, Indices{});
+            throw;
+        }
+
+        ++grown.m_size;
+        swap(grown);
+    }
+
+    void popBack()
+    {
+        assert(!empty() && "SoAVector::popBack: vector is empty");
+
+        --m_size;
+        _destroyRow(m_size, ColumnCount, Indices{});
+    }
+
+    void clear() noexcept
+    {
+        for (size_type row = 0; row < m_size; ++row)
+            _destroyRow(row, ColumnCount, Indices{});
+        m_size = 0;
+    }
+
+    void swap(SoAVector& other) noexcept
+    {
+        std::swap(m_storage, other.m_storage);
+        std::swap(m_columns, other.m_columns);
+        std::swap(m_size, other.m_size);
+        std::swap(m_capacity, other.m_capacity);
+    }
+
+private:
+    void* m_storage = nullptr;
+    std::tuple<Ts*...> m_columns{};
+    size_type m_size = 0;
+    size_type m_capacity = 0;
+
+    template<std::size_t... Is>
+    reference _row(const size_type row, std::index_sequence<Is...>)
+    {
+        return reference{std::get<Is>(m_columns)[row]...};
+    }
+
+    template<std::size_t... Is>
+    const_reference _row(const size_type row, std::index_sequence<Is...>) const
+    {
+        return const_reference{std::get<Is>(m_columns)[row]...};
+    }
+
+    template<std::size_t... Is, typename... Args>
+    void _constructRow(const size_type row, std::index_sequence<Is...>, Args&&... fields)
+    {
+        size_type constructed = 0;
+        try
+        {
+            ((new (std::get<Is>(m_columns) + row) Ts(std::forward<Args>(fields)), ++constructed), ...);
+        }
+        catch (...)
+        {
+            _destroyRow(row, constructed, Indices{});
+            throw;
+        }
+    }
+
+    // Destroys the first `columns` fields of `row`
+    template<std::size_t... Is>
+    void _destroyRow(const size_type row, const size_type columns, std::index_sequence<Is...>) noexcept
+    {
+        ((Is < columns ? std::get<Is>(m_columns)[row].~Ts() : void()), ...);
+    }
+
+    // Byte offset of every column for `capacity` rows; the last entry is the total size
+    static std::array<size_type, ColumnCount + 1> _layout(const size_type capacity) noexcept
+    {
+        std::array<size_type, ColumnCount + 1> offsets{};
+        constexpr size_type sizes[] = { sizeof(Ts)... };
+
+        size_type offset = 0;
+        for (size_type i = 0; i < ColumnCount; ++i)
+        {
+            offset = (offset + ColumnAlignment - 1) & ~(ColumnAlignment - 1);
+            offsets[i] = offset;
+            offset += capacity * sizes[i];
+        }
+        offsets[ColumnCount] = offset;
+
+        return offsets;
+    }
+
+    static void _deallocate(void* storage) noexcept
+    {
+        if (storage != nullptr)
+            operator delete(storage, std::align_val_t{ColumnAlignment});
+    }
+
+    // Gives an empty vector storage for `capacity` rows
+    template<std::size_t... Is>
+    void _allocate(const size_type capacity, std::index_sequence<Is...>)
+    {
+        const auto offsets = _layout(capacity);
+        m_storage = operator new(offsets[ColumnCount], std::align_val_t{ColumnAlignment});
+        auto* bytes = static_cast<std::byte*>(m_storage);
+
+        m_columns = std::tuple<Ts*...>{reinterpret_cast<Ts*>(bytes + offsets[Is])...};
+        m_capacity = capacity;
+    }
+
+    // Copies or moves every row into the empty `target`; if one throws, `target` owns and
+    // later destroys the rows built so far and this vector is unchanged
+    template<std::size_t... Is>
+    void _relocateInto(SoAVector& target, std::index_sequence<Is...>)
+    {
+        for (size_type row = 0; row < m_size; ++row)
+        {
+            target._constructRow(row, Indices{}, std::move_if_noexcept(std::get<Is>(m_columns)[row])...);
+            ++target.m_size;
+        }
+    }
+
+    void _reallocate(const size_type newCapacity)
+    {
+        SoAVector grown;
+        grown._allocate(newCapacity, Indices{});
+        _relocateInto(grown, Indices{});
+        swap(grown);
+    }
+};
+
+} // namespace cads
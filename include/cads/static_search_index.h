@@ -0,0 +1,55 @@
+#pragma once
+
+#include "cads/vector.h"
+
+#include <cstddef>
+
+namespace cads
+{
+
+enum class SearchLayout
+{
+    Eytzinger, // Implicit binary tree in BFS order, one node per key
+    BTree      // Implicit (B+1)-ary tree, one cache line of keys per node
+};
+
+template<typename ValType, SearchLayout Layout = SearchLayout::Eytzinger>
+class StaticSearchIndex // Read-only `lower_bound` accelerator over a sorted Vector
+{
+public:
+    using value_type = ValType;
+    using size_type  = std::size_t;
+
+    // -- Constructors --
+    StaticSearchIndex();
+    explicit StaticSearchIndex(const Vector<ValType>& sorted);
+
+    // -- Methods --
+    // - Build -
+    void rebuild(const Vector<ValType>& sorted);
+
+    // - Lookup -
+    // Both return positions in the `sorted` Vector the index was built from
+    [[nodiscard]] size_t lowerBound(const ValType& value) const; // size() if every key is less
+    [[nodiscard]] bool contains(const ValType& value) const;
+
+    // - Size -
+    [[nodiscard]] size_t size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+private:
+    // Keys that share one cache line
+    static constexpr size_t BlockSize = sizeof(ValType) >= 64 ? 1 : 64 / sizeof(ValType);
+
+    Vector<ValType> m_keys;  // Keys in layout order
+    Vector<size_t> m_ranks;  // Layout slot -> position in the sorted source
+    size_t m_size;
+    size_t m_blockCount;     // BTree only
+
+    void _build(const Vector<ValType>& sorted, size_t& next, size_t node);
+    size_t _findSlot(const ValType& value) const;
+};
+
+} // namespace cads
+
+#include "cads/static_search_index.tpp"
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "cads/detail/prefetch.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+
+// -- Constructors --
+template <typename ValType, cads::SearchLayout Layout>
+cads::StaticSearchIndex<ValType, Layout>::StaticSearchIndex()
+    : m_size{0}
+    , m_blockCount{0}
+{ }
+
+template <typename ValType, cads::SearchLayout Layout>
+cads::StaticSearchIndex<ValType, Layout>::StaticSearchIndex(const Vector<ValType>& sorted)
+    : StaticSearchIndex()
+{
+    rebuild(sorted);
+}
+
+// -- Methods --
+// - Build -
+template <typename ValType, cads::SearchLayout Layout>
+void cads::StaticSearchIndex<ValType, Layout>::rebuild(const Vector<ValType>& sorted)
+{
+    assert(std::is_sorted(sorted.begin(), sorted.end()) && "rebuild() requires sorted input");
+
+    m_size = sorted.size();
+    m_keys.clear();
+    m_ranks.clear();
+
+    if (m_size == 0)
+    {
+        m_blockCount = 0;
+        return;
+    }
+
+    size_t next = 0;
+
+    if constexpr (Layout == SearchLayout::Eytzinger)
+    {
+        // Slot 0 is the "not found" sentinel, the tree root lives at slot 1
+        m_keys = Vector<ValType>(m_size + 1, sorted[0]);
+        m_ranks = Vector<size_t>(m_size + 1, m_size);
+
+        _build(sorted, next, 1);
+    }
+    else
+    {
+        static_assert(std::numeric_limits<ValType>::is_specialized,
+                      "SearchLayout::BTree pads blocks with numeric_limits<ValType>::max()");
+
+        m_blockCount = (m_size + BlockSize - 1) / BlockSize;
+
+        // One trailing slot past the last block is the "not found" sentinel
+        const size_t slots = m_blockCount * BlockSize + 1;
+        m_keys = Vector<ValType>(slots, std::numeric_limits<ValType>::max());
+        m_ranks = Vector<size_t>(slots, m_size);
+
+        _build(sorted, next, 0);
+    }
+}
+
+// - Lookup -
+template <typename ValType, cads::SearchLayout Layout>
+size_t cads::StaticSearchIndex<ValType, Layout>::lowerBound(const ValType& value) const
+{
+    if (m_size == 0)
+        return 0;
+
+    return m_ranks[_findSlot(value)];
+}
+
+template <typename ValType, cads::SearchLayout Layout>
+bool cads::StaticSearchIndex<ValType, Layout>::contains(const ValType& value) const
+{
+    if (m_size == 0)
+        return false;
+
+    const size_t slot = _findSlot(value);
+    return m_ranks[slot] != m_size && !(value < m_keys[slot]);
+}
+
+// - Size -
+template <typename ValType, cads::SearchLayout Layout>
+size_t cads::StaticSearchIndex<ValType, Layout>::size() const noexcept
+{
+    return m_size;
+}
+
+template <typename ValType, cads::SearchLayout Layout>
+bool cads::StaticSearchIndex<ValType, Layout>::empty() const noexcept
+{
+    return m_size == 0;
+}
+
+// -- Private methods --
+// In-order walk of the implicit tree, handing out sorted keys one by one
+template <typename ValType, cads::SearchLayout Layout>
+void cads::StaticSearchIndex<ValType, Layout>::_build(const Vector<ValType>& sorted, size_t& next, const size_t node)
+{
+    if constexpr (Layout == SearchLayout::Eytzinger)
+    {
+        if (node > m_size)
+            return;
+
+        _build(sorted, next, 2 * node);
+
+        m_keys[node] = sorted[next];
+        m_ranks[node] = next;
+        ++next;
+
+        _build(sorted, next, 2 * node + 1);
+    }
+    else
+    {
+        if (node >= m_blockCount)
+            return;
+
+        for (size_t i = 0; i < BlockSize; ++i)
+        {
+            _build(sorted, next, node * (BlockSize + 1) + i + 1);
+
+            if (next < m_size)
+            {
+                m_keys[node * BlockSize + i] = sorted[next];
+                m_ranks[node * BlockSize + i] = next;
+                ++next;
+            }
+        }
+
+        _build(sorted, next, node * (BlockSize + 1) + BlockSize + 1);
+    }
+}
+
+template <typename ValType, cads::SearchLayout Layout>
+size_t cads::StaticSearchIndex<ValType, Layout>::_findSlot(const ValType& value) const
+{
+    const ValType* keys = m_keys.data();
+
+    // Prefetch addresses may run past the array; they are never dereferenced
+    auto prefetchSlot = [keys](const size_t slot) {
+        detail::prefetch(reinterpret_cast<const void*>(
+            reinterpret_cast<std::uintptr_t>(keys) + slot * sizeof(ValType)));
+    };
+
+    if constexpr (Layout == SearchLayout::Eytzinger)
+    {
+        size_t node = 1;
+        while (node <= m_size)
+        {
+            // The 16 great-great-grandchildren of `node` are contiguous
+            prefetchSlot(node * 16);
+            node = 2 * node + static_cast<size_t>(keys[node] < value);
+        }
+
+        // Undo the trailing right turns plus the final left one
+        return node >> (std::countr_one(node) + 1);
+    }
+    else
+    {
+        size_t result = m_blockCount * BlockSize;
+        size_t node = 0;
+
+        while (node < m_blockCount)
+        {
+            const ValType* block = keys + node * BlockSize;
+
+            size_t lessCount = 0;
+            for (size_t i = 0; i < BlockSize; ++i)
+                lessCount += static_cast<size_t>(block[i] < value);
+
+            const size_t child = node * (BlockSize + 1) + lessCount + 1;
+            prefetchSlot(child * BlockSize);
+
+            result = lessCount < BlockSize ? node * BlockSize + lessCount : result;
+            node = child;
+        }
+
+        return result;
+    }
+}
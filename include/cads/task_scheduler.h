@@ -0,0 +1,215 @@
+#pragma once
+
+#include "cads/queue.h"
+#include "cads/vector.h"
+#include "cads/work_stealing_deque.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace cads
+{
+
+// Fixed pool of workers, each owning a WorkStealingDeque. Tasks submitted from a worker go to
+// its own deque (LIFO for locality), tasks from other threads go through a shared injection
+// queue, and idle workers steal from random victims before going to sleep.
+class TaskScheduler
+{
+public:
+    using Task = std::function<void()>;
+
+    explicit TaskScheduler(size_t threadCount = std::thread::hardware_concurrency())
+    {
+        if (threadCount == 0)
+            threadCount = 1;
+
+        m_workers.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i)
+            m_workers.pushBack(std::make_unique<Worker>(i));
+
+        for (size_t i = 0; i < threadCount; ++i)
+            m_workers[i]->thread = std::thread{[this, i] { _workerLoop(i); }};
+    }
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    // Runs every task submitted so far, then stops the workers
+    ~TaskScheduler()
+    {
+        waitIdle();
+
+        m_stop.store(true);
+        {
+            std::lock_guard lock{m_sleepMutex};
+            m_wakeCondition.notify_all();
+        }
+
+        for (auto& worker : m_workers)
+            worker->thread.join();
+    }
+
+
+    // Tasks must not throw; an escaping exception terminates the worker thread
+    void submit(Task task)
+    {
+        auto* item = new Task{std::move(task)};
+        m_pending.fetch_add(1);
+
+        if (t_scheduler == this)
+            m_workers[t_workerIndex]->deque.push(item);
+        else
+        {
+            std::lock_guard lock{m_injectMutex};
+            m_injected.push(item);
+            m_injectedCount.fetch_add(1);
+        }
+
+        // Dekker-style pairing with the sleeper: either it sees the new count, or we see it asleep
+        m_queued.fetch_add(1);
+        if (m_sleeping.load() > 0)
+        {
+            std::lock_guard lock{m_sleepMutex};
+            m_wakeCondition.notify_one();
+        }
+    }
+
+    // Resumes a suspended coroutine on one of the workers, so the scheduler can serve as the
+    // executor of e.g. a Channel
+    void post(const std::coroutine_handle<> handle)
+    {
+        submit([handle] { handle.resume(); });
+    }
+
+    // Blocks until every submitted task has finished. Must not be called from a worker.
+    void waitIdle()
+    {
+        std::unique_lock lock{m_sleepMutex};
+        m_idleCondition.wait(lock, [this] { return m_pending.load() == 0; });
+    }
+
+    [[nodiscard]] size_t threadCount() const noexcept
+    {
+        return m_workers.size();
+    }
+
+private:
+    struct Worker
+    {
+        WorkStealingDeque<Task*> deque;
+        std::thread thread;
+        uint64_t rngState;
+
+        explicit Worker(const size_t index) : rngState{0x9E3779B97F4A7C15ull * (index + 1)} {}
+    };
+
+    static constexpr int SpinsBeforeSleep = 64;
+
+    Vector<std::unique_ptr<Worker>> m_workers;
+
+    std::mutex m_injectMutex;
+    Queue<Task*> m_injected;
+    std::atomic<size_t> m_injectedCount{0};
+
+    std::atomic<int64_t> m_queued{0};   // Submitted, not yet picked up
+    std::atomic<int64_t> m_pending{0};  // Submitted, not yet finished
+    std::atomic<int64_t> m_sleeping{0};
+    std::atomic<bool> m_stop{false};
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wakeCondition;
+    std::condition_variable m_idleCondition;
+
+    static inline thread_local const TaskScheduler* t_scheduler = nullptr;
+    static inline thread_local size_t t_workerIndex = 0;
+
+    void _workerLoop(const size_t index)
+    {
+        t_scheduler = this;
+        t_workerIndex = index;
+
+        int spins = 0;
+        while (true)
+        {
+            if (Task* task = _findTask(index))
+            {
+                spins = 0;
+                m_queued.fetch_sub(1);
+
+                (*task)();
+                delete task;
+
+                if (m_pending.fetch_sub(1) == 1)
+                {
+                    std::lock_guard lock{m_sleepMutex};
+                    m_idleCondition.notify_all();
+                }
+                continue;
+            }
+
+            if (m_stop.load())
+                break;
+
+            if (++spins < SpinsBeforeSleep)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            spins = 0;
+
+            std::unique_lock lock{m_sleepMutex};
+            m_sleeping.fetch_add(1);
+            while (!m_stop.load() && m_queued.load() <= 0)
+                m_wakeCondition.wait(lock);
+            m_sleeping.fetch_sub(1);
+        }
+    }
+
+    Task* _findTask(const size_t index)
+    {
+        Worker& self = *m_workers[index];
+
+        if (auto task = self.deque.pop())
+            return *task;
+
+        if (m_injectedCount.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard lock{m_injectMutex};
+            if (!m_injected.empty())
+            {
+                Task* task = m_injected.front();
+                m_injected.pop();
+                m_injectedCount.fetch_sub(1);
+                return task;
+            }
+        }
+
+        const size_t workerCount = m_workers.size();
+        for (size_t attempt = 0; attempt < 2 * workerCount; ++attempt)
+        {
+            // xorshift64
+            self.rngState ^= self.rngState << 13;
+            self.rngState ^= self.rngState >> 7;
+            self.rngState ^= self.rngState << 17;
+
+            const size_t victim = self.rngState % workerCount;
+            if (victim == index)
+                continue;
+
+            if (auto task = m_workers[victim]->deque.steal())
+                return *task;
+        }
+
+        return nullptr;
+    }
+};
+
+} // namespace cads
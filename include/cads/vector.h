@@ -123,6 +123,8 @@ public:
     Vector(std::initializer_list<ValType> list);
     Vector(const Vector& other);
     Vector(Vector&& other) noexcept;
+    // Reuses the existing buffer when it is large enough (basic guarantee);
+    // `v = Vector(other)` opts into the strong guarantee at the cost of an allocation
     Vector& operator=(const Vector& other);
     Vector& operator=(Vector&& other) noexcept;
     Vector& operator=(std::initializer_list<ValType> list);
@@ -179,9 +181,24 @@ public:
     void popBack();
     void clear() noexcept;
 
+    // Replace the contents, assigning over live elements like copy assignment does
+    void assign(size_t count, const ValType& value);
+    template<std::forward_iterator It>
+    void assign(It first, It last);
+
     Iterator erase(ConstIterator pos);
     Iterator erase(ConstIterator first, ConstIterator last);
 
+    // O(1): moves the last element into `pos`, so the order is not preserved
+    Iterator swapErase(ConstIterator pos);
+
+    // Single pass, stable; each return the number of removed elements
+    template<typename Predicate>
+    size_t eraseIf(Predicate pred);
+    size_t removeAll(const ValType& value);
+    // `sortedIndices` must be strictly increasing
+    size_t eraseIndices(const Vector<size_t>& sortedIndices);
+
     void swap(Vector& other) noexcept;
 
 private:
@@ -190,6 +207,7 @@ private:
     size_t m_capacity;
 
     void _reallocate(size_t newCapacity);
+    void _truncate(size_t newSize) noexcept;
 };
 
 } // namespace cads
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cassert>
 #include <new>
 #include <type_traits>
 #include <memory>
@@ -81,10 +82,8 @@ template <typename ValType>
 cads::Vector<ValType>& cads::Vector<ValType>::operator=(const Vector& other)
 {
     if (this != &other)
-    {
-        Vector temp{other};
-        swap(temp);
-    }
+        assign(other.m_data, other.m_data + other.m_size);
+
     return *this;
 }
 
@@ -110,8 +109,7 @@ cads::Vector<ValType>& cads::Vector<ValType>::operator=(Vector&& other) noexcept
 template <typename ValType>
 cads::Vector<ValType>& cads::Vector<ValType>::operator=(std::initializer_list<ValType> list)
 {
-    Vector temp{list};
-    swap(temp);
+    assign(list.begin(), list.end());
 
     return *this;
 }
@@ -436,6 +434,52 @@ void cads::Vector<ValType>::clear() noexcept
     m_size = 0;
 }
 
+template <typename ValType>
+void cads::Vector<ValType>::assign(const size_t count, const ValType& value)
+{
+    if (count > m_capacity)
+    {
+        // `value` may be an element of this vector, so copy it before the old buffer goes
+        const ValType copy = value;
+        clear();
+        _reallocate(count);
+
+        for (; m_size < count; ++m_size)
+            new (m_data + m_size) ValType(copy);
+        return;
+    }
+
+    const size_t common = std::min(count, m_size);
+    for (size_t i = 0; i < common; ++i)
+        m_data[i] = value;
+
+    for (; m_size < count; ++m_size)
+        new (m_data + m_size) ValType(value);
+    _truncate(count);
+}
+
+template <typename ValType>
+template <std::forward_iterator It>
+void cads::Vector<ValType>::assign(It first, It last)
+{
+    const auto count = static_cast<size_t>(std::distance(first, last));
+
+    // A range longer than the capacity cannot point into this vector
+    if (count > m_capacity)
+    {
+        clear();
+        _reallocate(count);
+    }
+
+    const size_t common = std::min(count, m_size);
+    for (size_t i = 0; i < common; ++i, ++first)
+        m_data[i] = *first;
+
+    for (; m_size < count; ++m_size, ++first)
+        new (m_data + m_size) ValType(*first);
+    _truncate(count);
+}
+
 template <typename ValType>
 typename cads::Vector<ValType>::Iterator cads::Vector<ValType>::erase(ConstIterator pos)
 {
@@ -475,6 +519,88 @@ typename cads::Vector<ValType>::Iterator cads::Vector<ValType>::erase(ConstItera
 }
 
 
+template <typename ValType>
+typename cads::Vector<ValType>::Iterator cads::Vector<ValType>::swapErase(ConstIterator pos)
+{
+    const auto index = std::distance(cbegin(), pos);
+
+    if (static_cast<size_t>(index) != m_size - 1)
+        m_data[index] = std::move(m_data[m_size - 1]);
+
+    popBack();
+    return begin() + index;
+}
+
+template <typename ValType>
+template <typename Predicate>
+size_t cads::Vector<ValType>::eraseIf(Predicate pred)
+{
+    size_t write = 0;
+
+    if constexpr (std::is_trivially_copyable_v<ValType>)
+    {
+        // Branchless stream compaction: always store, advance the write index only for kept
+        // elements. No unpredictable branch however the predicate results are distributed.
+        for (size_t read = 0; read < m_size; ++read)
+        {
+            const ValType value = m_data[read];
+            m_data[write] = value;
+            write += !static_cast<bool>(pred(value));
+        }
+    }
+    else
+    {
+        while (write < m_size && !pred(m_data[write]))
+            ++write;
+
+        for (size_t read = write + 1; read < m_size; ++read)
+        {
+            if (!pred(m_data[read]))
+            {
+                m_data[write] = std::move(m_data[read]);
+                ++write;
+            }
+        }
+    }
+
+    const size_t removed = m_size - write;
+    _truncate(write);
+    return removed;
+}
+
+template <typename ValType>
+size_t cads::Vector<ValType>::removeAll(const ValType& value)
+{
+    // Compare against a copy: `value` may be an element of this vector
+    const ValType target = value;
+    return eraseIf([&target](const ValType& item) { return item == target; });
+}
+
+template <typename ValType>
+size_t cads::Vector<ValType>::eraseIndices(const Vector<size_t>& sortedIndices)
+{
+    const size_t count = sortedIndices.size();
+    if (count == 0)
+        return 0;
+
+    assert(sortedIndices[count - 1] < m_size && "Vector::eraseIndices: index out of range");
+
+    // Shift each run between two erased indices down once; for trivially copyable types
+    // std::move over raw pointers becomes a memmove per run
+    ValType* write = m_data + sortedIndices[0];
+    for (size_t k = 0; k < count; ++k)
+    {
+        assert((k == 0 || sortedIndices[k - 1] < sortedIndices[k]) && "Vector::eraseIndices: indices must be strictly increasing");
+
+        ValType* runBegin = m_data + sortedIndices[k] + 1;
+        ValType* runEnd = m_data + (k + 1 < count ? sortedIndices[k + 1] : m_size);
+        write = std::move(runBegin, runEnd, write);
+    }
+
+    _truncate(m_size - count);
+    return count;
+}
+
 template <typename ValType>
 void cads::Vector<ValType>::swap(Vector& other) noexcept
 {
@@ -507,4 +633,16 @@ void cads::Vector<ValType>::_reallocate(const size_t newCapacity)
 
     m_data = newData.release();
     m_capacity = newCapacity;
+}
+
+template <typename ValType>
+void cads::Vector<ValType>::_truncate(const size_t newSize) noexcept
+{
+    if constexpr (!std::is_trivially_destructible_v<ValType>)
+    {
+        for (size_t i = newSize; i < m_size; ++i)
+            m_data[i].~ValType();
+    }
+
+    m_size = newSize;
 }
\ No newline at end of file
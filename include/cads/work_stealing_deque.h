@@ -0,0 +1,212 @@
+#pragma once
+
+#include "cads/vector.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace cads
+{
+
+// Chase-Lev deque with the C11 memory orderings of Lê et al., "Correct and Efficient
+// Work-Stealing for Weak Memory Models" (PPoPP 2013).
+// One owner thread calls push()/pop() at the bottom, any thread may steal() from the top.
+template<typename ValType>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable_v<ValType>,
+                  "WorkStealingDeque slots are atomics, store pointers or handles to larger items");
+
+public:
+    using value_type = ValType;
+    using size_type  = std::size_t;
+
+    explicit WorkStealingDeque(size_t initialCapacity = 64)
+        : m_top{0}
+        , m_bottom{0}
+        , m_ring{new Ring{_roundUpToPowerOfTwo(initialCapacity)}}
+        , m_activeThieves{0}
+    { }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    ~WorkStealingDeque()
+    {
+        for (Ring* ring : m_retired)
+            delete ring;
+        delete m_ring.load(std::memory_order_relaxed);
+    }
+
+
+    // - Owner -
+    void push(const ValType& value)
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_top.load(std::memory_order_acquire);
+        Ring* ring = m_ring.load(std::memory_order_relaxed);
+
+        if (bottom - top > static_cast<int64_t>(ring->mask))
+            ring = _grow(ring, top, bottom);
+
+        if (!m_retired.empty())
+            _reclaim();
+
+        ring->store(bottom, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    std::optional<ValType> pop()
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        Ring* ring = m_ring.load(std::memory_order_relaxed);
+        m_bottom.store(bottom, std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        const ValType value = ring->load(bottom);
+        if (top == bottom)
+        {
+            // Last element: race the thieves for it
+            const bool won = m_top.compare_exchange_strong(top, top + 1,
+                                                           std::memory_order_seq_cst,
+                                                           std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+            if (!won)
+                return std::nullopt;
+        }
+
+        return value;
+    }
+
+
+    // - Thieves -
+    // Empty result when the deque looked empty or another thread won the race
+    std::optional<ValType> steal()
+    {
+        m_activeThieves.fetch_add(1, std::memory_order_seq_cst);
+
+        std::optional<ValType> result;
+
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top < bottom)
+        {
+            Ring* ring = m_ring.load(std::memory_order_acquire);
+            const ValType value = ring->load(top);
+
+            if (m_top.compare_exchange_strong(top, top + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed))
+            {
+                result = value;
+            }
+        }
+
+        m_activeThieves.fetch_sub(1, std::memory_order_release);
+        return result;
+    }
+
+
+    // - Size -
+    // Snapshots, exact only while no other thread touches the deque
+    [[nodiscard]] size_type size() const noexcept
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return m_ring.load(std::memory_order_relaxed)->mask + 1;
+    }
+
+private:
+    struct Ring
+    {
+        size_t mask;
+        std::atomic<ValType>* slots;
+
+        explicit Ring(const size_t capacity)
+            : mask{capacity - 1}
+            , slots{new std::atomic<ValType>[capacity]}
+        { }
+
+        Ring(const Ring&) = delete;
+        Ring& operator=(const Ring&) = delete;
+
+        ~Ring() { delete[] slots; }
+
+        ValType load(const int64_t index) const
+        {
+            return slots[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+        }
+
+        void store(const int64_t index, const ValType& value)
+        {
+            slots[static_cast<size_t>(index) & mask].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(64) std::atomic<int64_t> m_top;
+    alignas(64) std::atomic<int64_t> m_bottom;
+    alignas(64) std::atomic<Ring*> m_ring;
+    std::atomic<size_t> m_activeThieves;
+    Vector<Ring*> m_retired; // Owner only
+
+    Ring* _grow(Ring* ring, const int64_t top, const int64_t bottom)
+    {
+        auto* bigger = new Ring{(ring->mask + 1) * 2};
+        for (int64_t i = top; i < bottom; ++i)
+            bigger->store(i, ring->load(i));
+
+        // seq_cst pairs with the counter in steal(): a thief that registers after
+        // _reclaim() read zero is guaranteed to load `bigger`
+        m_ring.store(bigger, std::memory_order_seq_cst);
+        m_retired.pushBack(ring);
+
+        return bigger;
+    }
+
+    // Thieves may still read a ring they loaded before the swap, so old rings are
+    // deferred until a moment with no steal() in flight
+    void _reclaim()
+    {
+        if (m_activeThieves.load(std::memory_order_seq_cst) != 0)
+            return;
+
+        for (Ring* ring : m_retired)
+            delete ring;
+        m_retired.clear();
+    }
+
+    static size_t _roundUpToPowerOfTwo(const size_t value)
+    {
+        size_t result = 2;
+        while (result < value)
+            result *= 2;
+        return result;
+    }
+};
+
+} // namespace cads
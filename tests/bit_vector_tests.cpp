@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include "cads/bit_vector.h"
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+// --- HELPERS ---
+cads::BitVector randomBits(const size_t size, const unsigned seed, const double density = 0.5)
+{
+    std::mt19937 rng{seed};
+    std::bernoulli_distribution coin{density};
+
+    cads::BitVector bits;
+    for (size_t i = 0; i < size; ++i)
+        bits.pushBack(coin(rng));
+    return bits;
+}
+
+// --- TESTS ---
+// BitVectorTest
+TEST(BitVectorTest, SetResetTest)
+{
+    cads::BitVector bits(100);
+    EXPECT_EQ(bits.size(), 100);
+    EXPECT_EQ(bits.wordCount(), 2);
+    EXPECT_TRUE(bits.none());
+
+    bits.set(0);
+    bits.set(63);
+    bits.set(64, true);
+    bits.set(99);
+    bits.flip(50);
+    EXPECT_EQ(bits.count(), 5);
+    EXPECT_TRUE(bits.test(64));
+
+    bits.reset(63);
+    bits.set(64, false);
+    bits.flip(50);
+    EXPECT_FALSE(bits[63]);
+    EXPECT_FALSE(bits[64]);
+    EXPECT_EQ(bits.count(), 2);
+
+    EXPECT_THROW(bits.at(100), std::out_of_range);
+}
+
+TEST(BitVectorTest, PushPopAndResize)
+{
+    cads::BitVector bits;
+    for (int i = 0; i < 130; ++i)
+        bits.pushBack(i % 3 == 0);
+
+    EXPECT_EQ(bits.size(), 130);
+    EXPECT_EQ(bits.count(), 44);
+
+    bits.popBack();
+    bits.popBack();
+    EXPECT_EQ(bits.size(), 128);
+    EXPECT_EQ(bits.wordCount(), 2);
+    EXPECT_EQ(bits.count(), 43);
+
+    bits.resize(200, true);
+    EXPECT_EQ(bits.count(), 43 + 72);
+    EXPECT_TRUE(bits.test(199));
+
+    bits.resize(10);
+    EXPECT_EQ(bits.count(), 4);
+
+    // Bits cut off by a shrink must not come back
+    bits.resize(64);
+    EXPECT_EQ(bits.count(), 4);
+
+    cads::BitVector ones(70, true);
+    EXPECT_TRUE(ones.all());
+    EXPECT_EQ(ones.words()[1], 0x3Fu);
+}
+
+TEST(BitVectorTest, BulkOperations)
+{
+    const cads::BitVector a = randomBits(1000, 1);
+    const cads::BitVector b = randomBits(1000, 2);
+
+    const cads::BitVector andBits = a & b;
+    const cads::BitVector orBits = a | b;
+    const cads::BitVector xorBits = a ^ b;
+    cads::BitVector andNotBits = a;
+    andNotBits.andNot(b);
+
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(andBits[i], a[i] && b[i]);
+        ASSERT_EQ(orBits[i], a[i] || b[i]);
+        ASSERT_EQ(xorBits[i], a[i] != b[i]);
+        ASSERT_EQ(andNotBits[i], a[i] && !b[i]);
+    }
+
+    EXPECT_EQ(andBits.count() + orBits.count(), a.count() + b.count());
+
+    cads::BitVector flipped = a;
+    flipped.flipAll();
+    EXPECT_EQ(flipped.count(), 1000 - a.count());
+    EXPECT_EQ(flipped ^ a, cads::BitVector(1000, true));
+}
+
+TEST(BitVectorTest, SetBitScanning)
+{
+    cads::BitVector bits(300);
+    const std::vector<size_t> positions = { 3, 64, 65, 127, 200, 299 };
+    for (const size_t pos : positions)
+        bits.set(pos);
+
+    std::vector<size_t> seen;
+    bits.forEachSetBit([&seen](size_t pos) { seen.push_back(pos); });
+    EXPECT_EQ(seen, positions);
+
+    EXPECT_EQ(bits.findFirst(), 3);
+    EXPECT_EQ(bits.findNext(4), 64);
+    EXPECT_EQ(bits.findNext(128), 200);
+    EXPECT_EQ(bits.findNext(300), 300);
+
+    bits.reset(299);
+    EXPECT_EQ(bits.findNext(201), 300);
+}
+
+// RankSelectIndexTest
+TEST(RankSelectIndexTest, MatchesNaiveRankAndSelect)
+{
+    for (const double density : { 0.01, 0.5, 0.99 })
+    {
+        const cads::BitVector bits = randomBits(5000, 7, density);
+        const cads::RankSelectIndex index{bits};
+
+        std::vector<size_t> ones;
+        size_t rank = 0;
+        for (size_t i = 0; i <= bits.size(); ++i)
+        {
+            ASSERT_EQ(index.rank1(i), rank);
+            ASSERT_EQ(index.rank0(i), i - rank);
+
+            if (i < bits.size() && bits[i])
+            {
+                ones.push_back(i);
+                ++rank;
+            }
+        }
+
+        ASSERT_EQ(index.count(), ones.size());
+        for (size_t k = 0; k < ones.size(); ++k)
+            ASSERT_EQ(index.select1(k), ones[k]);
+        EXPECT_EQ(index.select1(ones.size()), bits.size());
+    }
+}
+
+TEST(RankSelectIndexTest, EmptyAndWordAligned)
+{
+    const cads::BitVector empty;
+    const cads::RankSelectIndex emptyIndex{empty};
+    EXPECT_EQ(emptyIndex.rank1(0), 0);
+    EXPECT_EQ(emptyIndex.select1(0), 0);
+
+    const cads::BitVector full(512, true);
+    const cads::RankSelectIndex fullIndex{full};
+    EXPECT_EQ(fullIndex.rank1(512), 512);
+    EXPECT_EQ(fullIndex.select1(511), 511);
+}
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include "cads/blocking_queue.h"
+#include "cads/vector.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+// --- TESTS ---
+// BlockingQueueTest
+TEST(BlockingQueueTest, FIFO_Behaviour)
+{
+    cads::BlockingQueue<std::string> queue;
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.capacity(), cads::BlockingQueue<std::string>::Unbounded);
+    EXPECT_FALSE(queue.tryPop().has_value());
+
+    EXPECT_TRUE(queue.push("first"));
+    EXPECT_TRUE(queue.push(std::string{"second"}));
+    EXPECT_TRUE(queue.tryPush("third"));
+    EXPECT_EQ(queue.size(), 3);
+
+    EXPECT_EQ(queue.pop(), "first");
+    EXPECT_EQ(queue.tryPop(), "second");
+    EXPECT_EQ(queue.popFor(1ms), "third");
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(BlockingQueueTest, CapacityBoundsNonBlockingPush)
+{
+    cads::BlockingQueue<int> queue{2};
+
+    EXPECT_TRUE(queue.tryPush(1));
+    EXPECT_TRUE(queue.tryPush(2));
+    EXPECT_FALSE(queue.tryPush(3));
+    EXPECT_FALSE(queue.pushFor(3, 1ms));
+    EXPECT_EQ(queue.size(), 2);
+
+    queue.pop();
+    EXPECT_TRUE(queue.tryPush(3));
+}
+
+TEST(BlockingQueueTest, PopForTimesOutOnEmptyQueue)
+{
+    cads::BlockingQueue<int> queue;
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(queue.popFor(20ms).has_value());
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+}
+
+TEST(BlockingQueueTest, FullQueueBlocksProducerUntilConsumerPops)
+{
+    cads::BlockingQueue<int> queue{1};
+    queue.push(1);
+
+    std::atomic<bool> pushed{false};
+    std::thread producer{[&] {
+        queue.push(2);
+        pushed.store(true);
+    }};
+
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(pushed.load());
+
+    EXPECT_EQ(queue.pop(), 1);
+    producer.join();
+
+    EXPECT_TRUE(pushed.load());
+    EXPECT_EQ(queue.pop(), 2);
+}
+
+TEST(BlockingQueueTest, CloseWakesWaitersAndDrainsRemainder)
+{
+    cads::BlockingQueue<int> queue{1};
+
+    std::thread consumer{[&] {
+        // Consumes the single element, then waits until close()
+        EXPECT_EQ(queue.pop(), 1);
+        EXPECT_FALSE(queue.pop().has_value());
+    }};
+
+    queue.push(1);
+    std::this_thread::sleep_for(10ms);
+    queue.close();
+    consumer.join();
+
+    EXPECT_TRUE(queue.isClosed());
+    EXPECT_FALSE(queue.push(2));
+    EXPECT_FALSE(queue.tryPush(2));
+
+    cads::BlockingQueue<int> blockedProducer{1};
+    blockedProducer.push(1);
+
+    std::thread producer{[&] { EXPECT_FALSE(blockedProducer.push(2)); }};
+    std::this_thread::sleep_for(10ms);
+    blockedProducer.close();
+    producer.join();
+
+    // Elements pushed before close() are still delivered
+    EXPECT_EQ(blockedProducer.pop(), 1);
+    EXPECT_FALSE(blockedProducer.pop().has_value());
+}
+
+TEST(BlockingQueueTest, DrainToMovesBatch)
+{
+    cads::BlockingQueue<std::string> queue;
+    for (int i = 0; i < 5; ++i)
+        queue.push(std::to_string(i));
+
+    cads::Vector<std::string> out;
+    out.pushBack("x");
+
+    EXPECT_EQ(queue.drainTo(out, 3), 3);
+    ASSERT_EQ(out.size(), 4);
+    EXPECT_EQ(out[0], "x");
+    EXPECT_EQ(out[1], "0");
+    EXPECT_EQ(out[3], "2");
+    EXPECT_EQ(queue.size(), 2);
+
+    EXPECT_EQ(queue.drainTo(out, 10), 2);
+    EXPECT_EQ(out[5], "4");
+    EXPECT_EQ(queue.drainTo(out, 10), 0);
+}
+
+TEST(BlockingQueueTest, ProducersAndBatchConsumers)
+{
+    constexpr int producers = 4;
+    constexpr int perProducer = 20000;
+
+    cads::BlockingQueue<int> queue{256};
+
+    std::atomic<long long> sum{0};
+    std::atomic<int> received{0};
+
+    std::vector<std::thread> consumers;
+    for (int c = 0; c < 2; ++c)
+    {
+        consumers.emplace_back([&] {
+            cads::Vector<int> batch;
+            while (true)
+            {
+                batch.clear();
+                if (queue.drainTo(batch, 64) == 0)
+                {
+                    auto item = queue.pop();
+                    if (!item)
+                        break;
+                    batch.pushBack(*item);
+                }
+
+                for (const int value : batch)
+                    sum.fetch_add(value);
+                received.fetch_add(static_cast<int>(batch.size()));
+            }
+        });
+    }
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&queue] {
+            for (int i = 1; i <= perProducer; ++i)
+                ASSERT_TRUE(queue.push(i));
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+    queue.close();
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    EXPECT_EQ(received.load(), producers * perProducer);
+    EXPECT_EQ(sum.load(), static_cast<long long>(producers) * perProducer * (perProducer + 1) / 2);
+}
@@ -0,0 +1,297 @@
+#include <gtest/gtest.h>
+#include "cads/btree_map.h"
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+// --- HELPERS ---
+template <typename Map>
+void expectSameContent(const Map& map, const std::map<int, int>& reference)
+{
+    ASSERT_EQ(map.size(), reference.size());
+
+    auto expected = reference.begin();
+    for (auto it = map.begin(); it != map.end(); ++it, ++expected)
+    {
+        ASSERT_EQ(it.key(), expected->first);
+        ASSERT_EQ(it.value(), expected->second);
+    }
+
+    auto expectedReverse = reference.rbegin();
+    for (auto it = map.rbegin(); it != map.rend(); ++it, ++expectedReverse)
+    {
+        ASSERT_EQ(it->first, expectedReverse->first);
+        ASSERT_EQ(it->second, expectedReverse->second);
+    }
+}
+
+template <size_t NodeBytes>
+void randomizedAgainstStdMap(const unsigned seed)
+{
+    cads::BTreeMap<int, int, NodeBytes> map;
+    std::map<int, int> reference;
+
+    std::mt19937 rng{seed};
+    std::uniform_int_distribution<int> keys{0, 2000};
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        const int key = keys(rng);
+
+        if (rng() % 3 != 0)
+        {
+            const auto [it, inserted] = map.insert(key, step);
+            const bool expected = reference.emplace(key, step).second;
+
+            ASSERT_EQ(inserted, expected);
+            ASSERT_EQ(it.key(), key);
+            ASSERT_EQ(it.value(), reference[key]);
+        }
+        else
+            ASSERT_EQ(map.erase(key), reference.erase(key));
+    }
+
+    expectSameContent(map, reference);
+
+    // Drain completely to exercise every merge path down to an empty root
+    while (!reference.empty())
+    {
+        const int key = reference.begin()->first;
+        ASSERT_EQ(map.erase(key), 1);
+        reference.erase(key);
+    }
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+// Key and value type whose copies can be told to fail after a number of successes
+struct FlakyCopy {
+    static inline int liveInstances = 0;
+    static inline int copiesUntilThrow = -1;
+
+    int value = 0;
+
+    FlakyCopy(int v = 0) : value(v) {
+        liveInstances++;
+    }
+
+    FlakyCopy(const FlakyCopy& other) : value(other.value) {
+        if (copiesUntilThrow == 0)
+            throw std::runtime_error("copy failed");
+        if (copiesUntilThrow > 0)
+            copiesUntilThrow--;
+        liveInstances++;
+    }
+
+    ~FlakyCopy() {
+        liveInstances--;
+    }
+
+    FlakyCopy& operator=(const FlakyCopy&) = default;
+    bool operator<(const FlakyCopy& other) const { return value < other.value; }
+    bool operator==(const FlakyCopy& other) const { return value == other.value; }
+};
+
+// --- TESTS ---
+// BTreeMapTest
+TEST(BTreeMapTest, DefaultConstructor)
+{
+    cads::BTreeMap<int, int> map;
+
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(map.find(1), map.end());
+    EXPECT_FALSE(map.contains(1));
+}
+
+TEST(BTreeMapTest, NodesFitTheirByteBudget)
+{
+    using Map = cads::BTreeMap<uint64_t, uint64_t, 256>;
+
+    EXPECT_EQ(Map::LeafCapacity, 14);
+    EXPECT_EQ(Map::InnerCapacity, 15);
+}
+
+// BTreeMapModifiersTest
+TEST(BTreeMapModifiersTest, InsertAndFind)
+{
+    cads::BTreeMap<int, std::string, 64> map;
+
+    for (int i = 0; i < 500; ++i)
+        EXPECT_TRUE(map.insert((i * 7919) % 500, std::to_string(i)).second);
+
+    EXPECT_EQ(map.size(), 500);
+    EXPECT_FALSE(map.insert(42, "duplicate").second);
+
+    for (int i = 0; i < 500; ++i)
+    {
+        auto it = map.find((i * 7919) % 500);
+        ASSERT_NE(it, map.end());
+        EXPECT_EQ(it.value(), std::to_string(i));
+    }
+    EXPECT_EQ(map.find(500), map.end());
+}
+
+TEST(BTreeMapModifiersTest, InsertOrAssignAndSubscript)
+{
+    cads::BTreeMap<int, int> map;
+
+    map[3] = 30;
+    map[1] += 10;
+    EXPECT_EQ(map.at(3), 30);
+    EXPECT_EQ(map.at(1), 10);
+
+    EXPECT_FALSE(map.insertOrAssign(3, 33).second);
+    EXPECT_EQ(map.at(3), 33);
+    EXPECT_TRUE(map.insertOrAssign(4, 44).second);
+    EXPECT_EQ(map.size(), 3);
+
+    EXPECT_THROW(map.at(100), std::out_of_range);
+}
+
+TEST(BTreeMapModifiersTest, RandomizedEvenInnerCapacity)
+{
+    randomizedAgainstStdMap<64>(1);
+}
+
+TEST(BTreeMapModifiersTest, RandomizedOddInnerCapacity)
+{
+    randomizedAgainstStdMap<80>(2);
+}
+
+TEST(BTreeMapModifiersTest, RandomizedDefaultNodes)
+{
+    randomizedAgainstStdMap<256>(3);
+}
+
+TEST(BTreeMapModifiersTest, EraseByIteratorReturnsSuccessor)
+{
+    cads::BTreeMap<int, int, 64> map;
+    for (int i = 0; i < 100; ++i)
+        map.insert(i, i);
+
+    auto it = map.find(10);
+    while (it != map.end() && it.key() < 60)
+        it = map.erase(it);
+
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it.key(), 60);
+    EXPECT_EQ(map.size(), 50);
+    EXPECT_FALSE(map.contains(10));
+    EXPECT_TRUE(map.contains(9));
+}
+
+// BTreeMapLookupTest
+TEST(BTreeMapLookupTest, RangeScan)
+{
+    cads::BTreeMap<int, int, 64> map;
+    for (int i = 0; i < 1000; i += 2)
+        map.insert(i, i * 10);
+
+    EXPECT_EQ(map.lowerBound(101).key(), 102);
+    EXPECT_EQ(map.lowerBound(102).key(), 102);
+    EXPECT_EQ(map.upperBound(102).key(), 104);
+    EXPECT_EQ(map.lowerBound(999), map.end());
+
+    int sum = 0;
+    for (auto it = map.lowerBound(100); it != map.upperBound(110); ++it)
+        sum += it.value();
+    EXPECT_EQ(sum, (100 + 102 + 104 + 106 + 108 + 110) * 10);
+}
+
+// BTreeMapMemoryTest
+TEST(BTreeMapMemoryTest, BulkLoad)
+{
+    for (int count : { 0, 1, 5, 6, 37, 1000 })
+    {
+        cads::Vector<std::pair<int, int>> sorted;
+        std::map<int, int> reference;
+        for (int i = 0; i < count; ++i)
+        {
+            sorted.pushBack({ i * 3, i });
+            reference.emplace(i * 3, i);
+        }
+
+        cads::BTreeMap<int, int, 64> map;
+        map.insert(-1, -1);
+        map.bulkLoad(sorted);
+        expectSameContent(map, reference);
+
+        // The loaded tree must keep working under updates
+        for (int i = 0; i < count; i += 2)
+        {
+            map.erase(i * 3);
+            reference.erase(i * 3);
+            map.insert(i * 3 + 1, i);
+            reference.emplace(i * 3 + 1, i);
+        }
+        expectSameContent(map, reference);
+    }
+}
+
+TEST(BTreeMapMemoryTest, CopyAndMove)
+{
+    cads::BTreeMap<std::string, int, 128> map;
+    for (int i = 0; i < 300; ++i)
+        map.insert(std::to_string(i), i);
+
+    cads::BTreeMap<std::string, int, 128> copy{map};
+    EXPECT_EQ(copy.size(), 300);
+    EXPECT_EQ(copy.at("150"), 150);
+
+    copy.erase("150");
+    EXPECT_TRUE(map.contains("150"));
+
+    cads::BTreeMap<std::string, int, 128> moved{std::move(copy)};
+    EXPECT_EQ(moved.size(), 299);
+    EXPECT_TRUE(copy.empty());
+
+    copy = moved;
+    EXPECT_EQ(copy.size(), 299);
+
+    map = std::move(moved);
+    EXPECT_EQ(map.size(), 299);
+    EXPECT_FALSE(map.contains("150"));
+}
+
+TEST(BTreeMapMemoryTest, ThrowingCopyDuringBuildLeaksNothing)
+{
+    using FlakyMap = cads::BTreeMap<FlakyCopy, FlakyCopy, 64>;
+
+    {
+        FlakyMap map;
+        for (int i = 0; i < 1000; ++i)
+            map.insert(FlakyCopy{i}, FlakyCopy{-i});
+        const int baseline = FlakyCopy::liveInstances;
+
+        // Fails among the leaves, on a key and on a value, then among the inner separators
+        for (const int copies : { 700, 701, 2000 + 5 })
+        {
+            FlakyCopy::copiesUntilThrow = copies;
+            EXPECT_THROW({ const FlakyMap copy{map}; }, std::runtime_error);
+            FlakyCopy::copiesUntilThrow = -1;
+            EXPECT_EQ(FlakyCopy::liveInstances, baseline);
+        }
+
+        cads::Vector<std::pair<FlakyCopy, FlakyCopy>> sorted;
+        for (int i = 0; i < 100; ++i)
+            sorted.pushBack({ FlakyCopy{i}, FlakyCopy{i} });
+        const int withSorted = FlakyCopy::liveInstances;
+
+        FlakyMap loaded;
+        FlakyCopy::copiesUntilThrow = 51;
+        EXPECT_THROW(loaded.bulkLoad(sorted), std::runtime_error);
+        FlakyCopy::copiesUntilThrow = -1;
+        EXPECT_TRUE(loaded.empty());
+        EXPECT_EQ(loaded.begin(), loaded.end());
+        EXPECT_EQ(FlakyCopy::liveInstances, withSorted);
+
+        loaded.bulkLoad(sorted);
+        EXPECT_EQ(loaded.size(), 100);
+    }
+
+    EXPECT_EQ(FlakyCopy::liveInstances, 0);
+}
@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+#include "cads/channel.h"
+#include "cads/single_thread_executor.h"
+#include "cads/task_scheduler.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// --- HELPERS ---
+cads::DetachedTask produce(cads::Channel<int>& channel, const int count, std::vector<bool>& results)
+{
+    for (int i = 0; i < count; ++i)
+        results.push_back(co_await channel.push(i));
+}
+
+cads::DetachedTask consume(cads::Channel<int>& channel, std::vector<int>& received)
+{
+    while (auto value = co_await channel.pop())
+        received.push_back(*value);
+}
+
+cads::DetachedTask produceAndClose(cads::Channel<int>& channel, const int count)
+{
+    for (int i = 0; i < count; ++i)
+        co_await channel.push(i);
+    channel.close();
+}
+
+// --- TESTS ---
+// ChannelTest
+TEST(ChannelTest, BufferedPushDoesNotSuspend)
+{
+    cads::SingleThreadExecutor executor;
+    cads::Channel<int> channel{executor, 4};
+    std::vector<bool> results;
+
+    executor.spawn(produce(channel, 4, results));
+    executor.run();
+
+    EXPECT_EQ(results, std::vector<bool>(4, true));
+    EXPECT_EQ(channel.size(), 4);
+    EXPECT_EQ(channel.capacity(), 4);
+
+    std::vector<int> received;
+    channel.close();
+    executor.spawn(consume(channel, received));
+    executor.run();
+
+    // Closing keeps buffered values poppable
+    EXPECT_EQ(received, (std::vector<int>{ 0, 1, 2, 3 }));
+    EXPECT_EQ(channel.size(), 0);
+}
+
+TEST(ChannelTest, FullChannelSuspendsProducer)
+{
+    cads::SingleThreadExecutor executor;
+    cads::Channel<int> channel{executor, 2};
+    std::vector<bool> results;
+    std::vector<int> received;
+
+    executor.spawn(produce(channel, 100, results));
+    executor.run();
+    EXPECT_EQ(results.size(), 2);
+
+    executor.spawn(consume(channel, received));
+    executor.run();
+
+    EXPECT_EQ(results.size(), 100);
+    ASSERT_EQ(received.size(), 100);
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(received[i], i);
+
+    channel.close();
+}
+
+TEST(ChannelTest, RendezvousChannel)
+{
+    cads::SingleThreadExecutor executor;
+    cads::Channel<int> channel{executor};
+    std::vector<int> received;
+
+    executor.spawn(consume(channel, received));
+    executor.spawn(produceAndClose(channel, 50));
+    executor.run();
+
+    EXPECT_EQ(channel.size(), 0);
+    ASSERT_EQ(received.size(), 50);
+    EXPECT_EQ(received.back(), 49);
+    EXPECT_TRUE(channel.isClosed());
+}
+
+TEST(ChannelTest, CloseWakesSuspendedPushersAndPoppers)
+{
+    cads::SingleThreadExecutor executor;
+
+    cads::Channel<int> full{executor, 1};
+    std::vector<bool> results;
+    executor.spawn(produce(full, 3, results));
+    executor.run();
+    EXPECT_EQ(results, std::vector<bool>{ true });
+
+    // Woken through the executor, not inline
+    full.close();
+    EXPECT_EQ(results, std::vector<bool>{ true });
+    executor.run();
+    EXPECT_EQ(results, (std::vector<bool>{ true, false, false }));
+
+    cads::Channel<int> empty{executor, 1};
+    std::vector<int> first;
+    std::vector<int> second;
+    executor.spawn(consume(empty, first));
+    executor.spawn(consume(empty, second));
+    executor.run();
+
+    int finished = 0;
+    executor.spawn([](cads::Channel<int>& channel, int& finished) -> cads::DetachedTask {
+        co_await channel.push(7);
+        ++finished;
+    }(empty, finished));
+    executor.run();
+
+    EXPECT_EQ(finished, 1);
+    EXPECT_EQ(first, std::vector<int>{ 7 });
+
+    empty.close();
+    executor.run();
+    EXPECT_TRUE(second.empty());
+
+    // Pushing to a closed channel completes immediately with false
+    std::optional<bool> lateResult;
+    executor.spawn([](cads::Channel<int>& channel, std::optional<bool>& result) -> cads::DetachedTask {
+        result = co_await channel.push(1);
+    }(empty, lateResult));
+    executor.run();
+    EXPECT_EQ(lateResult, false);
+}
+
+TEST(ChannelTest, MoveOnlyValues)
+{
+    cads::SingleThreadExecutor executor;
+    cads::Channel<std::unique_ptr<std::string>> channel{executor, 1};
+    std::vector<std::string> received;
+
+    executor.spawn([](auto& channel) -> cads::DetachedTask {
+        for (int i = 0; i < 3; ++i)
+            co_await channel.push(std::make_unique<std::string>(std::to_string(i)));
+        channel.close();
+    }(channel));
+
+    executor.spawn([](auto& channel, auto& received) -> cads::DetachedTask {
+        while (auto value = co_await channel.pop())
+            received.push_back(**value);
+    }(channel, received));
+
+    executor.run();
+    EXPECT_EQ(received, (std::vector<std::string>{ "0", "1", "2" }));
+}
+
+TEST(ChannelTest, YieldInterleavesCoroutines)
+{
+    cads::SingleThreadExecutor executor;
+    std::string trace;
+
+    auto worker = [](cads::SingleThreadExecutor& executor, std::string& trace, char name) -> cads::DetachedTask {
+        for (int i = 0; i < 3; ++i)
+        {
+            trace += name;
+            co_await executor.yield();
+        }
+    };
+
+    executor.spawn(worker(executor, trace, 'a'));
+    executor.spawn(worker(executor, trace, 'b'));
+    executor.run();
+
+    EXPECT_EQ(trace, "ababab");
+}
+
+TEST(ChannelTest, ExecutorsOnSeparateThreads)
+{
+    constexpr int count = 20000;
+
+    // Started on their own threads, woken on the scheduler's workers
+    cads::TaskScheduler scheduler{2};
+    cads::Channel<int> channel{scheduler, 16};
+    std::vector<int> received;
+
+    std::thread consumerThread{[&] {
+        cads::SingleThreadExecutor executor;
+        executor.spawn(consume(channel, received));
+        executor.run();
+    }};
+    std::thread producerThread{[&] {
+        cads::SingleThreadExecutor executor;
+        executor.spawn(produceAndClose(channel, count));
+        executor.run();
+    }};
+
+    producerThread.join();
+    consumerThread.join();
+    scheduler.waitIdle();
+
+    ASSERT_EQ(received.size(), count);
+    for (int i = 0; i < count; ++i)
+        EXPECT_EQ(received[i], i);
+}
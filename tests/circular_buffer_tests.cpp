@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include "cads/circular_buffer.h"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// --- HELPERS ---
+template <typename Buffer>
+std::vector<typename Buffer::value_type> contents(const Buffer& buffer)
+{
+    return {buffer.begin(), buffer.end()};
+}
+
+// --- TESTS ---
+// CircularBufferTest
+TEST(CircularBufferTest, OverwritesOldestWhenFull)
+{
+    cads::CircularBuffer<int, 4> buffer;
+
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(buffer.capacity(), 4);
+
+    for (int i = 0; i < 3; ++i)
+        buffer.pushBack(i);
+    EXPECT_FALSE(buffer.full());
+    EXPECT_EQ(contents(buffer), (std::vector<int>{ 0, 1, 2 }));
+
+    for (int i = 3; i < 10; ++i)
+        buffer.pushBack(i);
+
+    EXPECT_TRUE(buffer.full());
+    EXPECT_EQ(buffer.size(), 4);
+    EXPECT_EQ(contents(buffer), (std::vector<int>{ 6, 7, 8, 9 }));
+    EXPECT_EQ(buffer.front(), 6);
+    EXPECT_EQ(buffer.back(), 9);
+    EXPECT_EQ(buffer[1], 7);
+}
+
+TEST(CircularBufferTest, RuntimeCapacity)
+{
+    cads::CircularBuffer<std::string> buffer{3};
+    EXPECT_EQ(buffer.capacity(), 3);
+
+    for (int i = 0; i < 5; ++i)
+        buffer.emplaceBack(std::to_string(i));
+
+    EXPECT_EQ(contents(buffer), (std::vector<std::string>{ "2", "3", "4" }));
+
+    // Argument aliasing the element that gets overwritten
+    buffer.pushBack(buffer.front());
+    EXPECT_EQ(contents(buffer), (std::vector<std::string>{ "3", "4", "2" }));
+}
+
+TEST(CircularBufferTest, PopFrontAndBack)
+{
+    cads::CircularBuffer<int, 3> buffer;
+    for (int i = 0; i < 5; ++i)
+        buffer.pushBack(i);
+
+    buffer.popFront();
+    EXPECT_EQ(contents(buffer), (std::vector<int>{ 3, 4 }));
+
+    buffer.popBack();
+    EXPECT_EQ(contents(buffer), std::vector<int>{ 3 });
+
+    buffer.pushBack(5);
+    buffer.pushBack(6);
+    EXPECT_EQ(contents(buffer), (std::vector<int>{ 3, 5, 6 }));
+
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(CircularBufferTest, AtThrowsOutOfRange)
+{
+    cads::CircularBuffer<int> buffer{2};
+    buffer.pushBack(1);
+
+    EXPECT_EQ(buffer.at(0), 1);
+    EXPECT_THROW(buffer.at(1), std::out_of_range);
+}
+
+TEST(CircularBufferTest, RandomAccessIterators)
+{
+    cads::CircularBuffer<int, 8> buffer;
+    for (int i = 0; i < 13; ++i)
+        buffer.pushBack(13 - i);
+
+    auto it = buffer.begin();
+    EXPECT_EQ(it[2], 6);
+    EXPECT_EQ(*(it + 7), 1);
+    EXPECT_EQ(buffer.end() - buffer.begin(), 8);
+
+    std::sort(buffer.begin(), buffer.end());
+    EXPECT_TRUE(std::is_sorted(buffer.cbegin(), buffer.cend()));
+    EXPECT_EQ(std::accumulate(buffer.begin(), buffer.end(), 0), 36);
+
+    EXPECT_EQ(*buffer.rbegin(), 8);
+    EXPECT_EQ(*std::lower_bound(buffer.begin(), buffer.end(), 4), 4);
+}
+
+TEST(CircularBufferTest, LinearizeFullAndPartialWrap)
+{
+    cads::CircularBuffer<int, 5> full;
+    for (int i = 0; i < 7; ++i)
+        full.pushBack(i);
+
+    auto span = full.linearize();
+    EXPECT_EQ(std::vector<int>(span.begin(), span.end()), (std::vector<int>{ 2, 3, 4, 5, 6 }));
+
+    // Already contiguous: same span again
+    EXPECT_EQ(full.linearize().data(), span.data());
+
+    cads::CircularBuffer<std::string> partial{5};
+    for (int i = 0; i < 7; ++i)
+        partial.pushBack(std::to_string(i));
+    partial.popFront();
+    partial.popFront();
+
+    auto strings = partial.linearize();
+    EXPECT_EQ(std::vector<std::string>(strings.begin(), strings.end()),
+              (std::vector<std::string>{ "4", "5", "6" }));
+
+    partial.pushBack("7");
+    EXPECT_EQ(contents(partial), (std::vector<std::string>{ "4", "5", "6", "7" }));
+}
+
+TEST(CircularBufferTest, CopyAndMove)
+{
+    cads::CircularBuffer<std::unique_ptr<int>, 2> owning;
+    for (int i = 0; i < 3; ++i)
+        owning.pushBack(std::make_unique<int>(i));
+
+    auto moved = std::move(owning);
+    EXPECT_TRUE(owning.empty());
+    ASSERT_EQ(moved.size(), 2);
+    EXPECT_EQ(*moved.front(), 1);
+
+    cads::CircularBuffer<std::string> source{3};
+    for (int i = 0; i < 4; ++i)
+        source.pushBack(std::to_string(i));
+
+    cads::CircularBuffer<std::string> copy{source};
+    EXPECT_EQ(contents(copy), contents(source));
+
+    cads::CircularBuffer<std::string> assigned{1};
+    assigned = source;
+    EXPECT_EQ(assigned.capacity(), 3);
+    EXPECT_EQ(contents(assigned), (std::vector<std::string>{ "1", "2", "3" }));
+
+    assigned = std::move(copy);
+    EXPECT_EQ(contents(assigned), contents(source));
+    EXPECT_EQ(copy.capacity(), 0);
+
+    // A moved-from dynamic buffer refuses pushes until it gets storage again
+    EXPECT_THROW(copy.pushBack("x"), std::logic_error);
+    copy = source;
+    copy.pushBack("x");
+    EXPECT_EQ(copy.back(), "x");
+}
+
+TEST(CircularBufferTest, ZeroCapacityThrows)
+{
+    EXPECT_THROW(cads::CircularBuffer<int>{0}, std::invalid_argument);
+}
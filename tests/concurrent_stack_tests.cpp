@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include "cads/concurrent_stack.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+// --- TESTS ---
+// ConcurrentStackTest
+TEST(ConcurrentStackTest, LIFO_Behaviour)
+{
+    cads::ConcurrentStack<std::string> stack;
+
+    EXPECT_TRUE(stack.empty());
+    EXPECT_FALSE(stack.tryPop().has_value());
+
+    stack.push("first");
+    stack.push(std::string{"second"});
+    stack.emplace(3, 'x');
+    EXPECT_FALSE(stack.empty());
+
+    EXPECT_EQ(stack.tryPop(), "xxx");
+    EXPECT_EQ(stack.tryPop(), "second");
+    EXPECT_EQ(stack.tryPop(), "first");
+    EXPECT_TRUE(stack.empty());
+}
+
+TEST(ConcurrentStackTest, PopAllDrainsNewestFirst)
+{
+    cads::ConcurrentStack<int> stack;
+    for (int i = 0; i < 5; ++i)
+        stack.push(i);
+
+    std::vector<int> drained;
+    EXPECT_EQ(stack.popAll([&drained](int&& value) { drained.push_back(value); }), 5);
+    EXPECT_EQ(drained, (std::vector<int>{ 4, 3, 2, 1, 0 }));
+    EXPECT_TRUE(stack.empty());
+
+    EXPECT_EQ(stack.popAll([](int&&) { FAIL(); }), 0);
+
+    // Recycled nodes are reused by later pushes
+    stack.push(7);
+    EXPECT_EQ(stack.tryPop(), 7);
+}
+
+TEST(ConcurrentStackTest, DestructorReleasesRemainingValues)
+{
+    cads::ConcurrentStack<std::string> stack;
+    for (int i = 0; i < 100; ++i)
+        stack.push(std::string(64, 'a'));
+
+    for (int i = 0; i < 50; ++i)
+        stack.tryPop();
+}
+
+TEST(ConcurrentStackTest, ConcurrentPushAndPop)
+{
+    constexpr int threads = 4;
+    constexpr int perThread = 50000;
+
+    cads::ConcurrentStack<int> stack;
+    std::vector<std::atomic<int>> seen(threads * perThread);
+    std::atomic<int> popped{0};
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < perThread; ++i)
+            {
+                stack.push(t * perThread + i);
+
+                if (i % 2 == 0)
+                {
+                    if (auto value = stack.tryPop())
+                    {
+                        seen[*value].fetch_add(1);
+                        popped.fetch_add(1);
+                    }
+                }
+                else if (i % 97 == 0)
+                {
+                    popped.fetch_add(static_cast<int>(stack.popAll([&seen](int&& value) {
+                        seen[value].fetch_add(1);
+                    })));
+                }
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    while (auto value = stack.tryPop())
+    {
+        seen[*value].fetch_add(1);
+        popped.fetch_add(1);
+    }
+
+    EXPECT_EQ(popped.load(), threads * perThread);
+    for (int i = 0; i < threads * perThread; ++i)
+        ASSERT_EQ(seen[i].load(), 1) << "value " << i;
+}
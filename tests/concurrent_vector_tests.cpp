@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include "cads/concurrent_vector.h"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+// --- TESTS ---
+// ConcurrentVectorTest
+TEST(ConcurrentVectorTest, PushBackReturnsIndices)
+{
+    cads::ConcurrentVector<std::string, 4> vec;
+    EXPECT_TRUE(vec.empty());
+
+    EXPECT_EQ(vec.pushBack("a"), 0);
+    EXPECT_EQ(vec.emplaceBack(3, 'b'), 1);
+
+    const std::string c = "c";
+    EXPECT_EQ(vec.pushBack(c), 2);
+
+    EXPECT_EQ(vec.size(), 3);
+    EXPECT_EQ(vec[1], "bbb");
+    EXPECT_EQ(vec[2], "c");
+}
+
+TEST(ConcurrentVectorTest, GrowByAcrossSegments)
+{
+    cads::ConcurrentVector<int, 4> vec;
+    vec.pushBack(-1);
+
+    EXPECT_EQ(vec.growBy(30, 7), 1);
+    EXPECT_EQ(vec.size(), 31);
+    for (size_t i = 1; i < 31; ++i)
+        ASSERT_EQ(vec[i], 7);
+
+    EXPECT_EQ(vec.growBy(0), 31);
+    EXPECT_EQ(vec.growBy(2), 31);
+    EXPECT_EQ(vec[32], 0);
+
+    cads::ConcurrentVector<std::string> strings;
+    strings.growBy(40, "x");
+    EXPECT_EQ(strings[39], "x");
+}
+
+TEST(ConcurrentVectorTest, ElementsNeverMove)
+{
+    cads::ConcurrentVector<int, 2> vec;
+    vec.pushBack(1);
+    const int* first = &vec[0];
+
+    for (int i = 0; i < 10000; ++i)
+        vec.pushBack(i);
+
+    EXPECT_EQ(first, &vec[0]);
+}
+
+TEST(ConcurrentVectorTest, ToVector)
+{
+    cads::ConcurrentVector<std::string, 4> vec;
+    for (int i = 0; i < 50; ++i)
+        vec.pushBack(std::to_string(i));
+
+    const cads::Vector<std::string> copy = vec.toVector();
+    ASSERT_EQ(copy.size(), 50);
+    EXPECT_EQ(copy[49], "49");
+    EXPECT_EQ(vec[49], "49");
+
+    const cads::Vector<std::string> moved = std::move(vec).toVector();
+    ASSERT_EQ(moved.size(), 50);
+    EXPECT_EQ(moved[17], "17");
+    EXPECT_TRUE(vec.empty());
+
+    vec.pushBack("again");
+    EXPECT_EQ(vec[0], "again");
+}
+
+TEST(ConcurrentVectorTest, ConcurrentAppends)
+{
+    constexpr int threads = 4;
+    constexpr int perThread = 20000;
+
+    cads::ConcurrentVector<int, 8> vec;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&vec, t] {
+            for (int i = 0; i < perThread; ++i)
+            {
+                if (i % 100 == 0)
+                {
+                    const size_t first = vec.growBy(10, -1);
+                    EXPECT_EQ(vec[first + 9], -1);
+                }
+
+                const size_t index = vec.pushBack(t * perThread + i);
+
+                // The appending thread may read its own element right away
+                ASSERT_EQ(vec[index], t * perThread + i);
+            }
+        });
+    }
+
+    for (auto& worker : workers)
+        worker.join();
+
+    const cads::Vector<int> result = std::move(vec).toVector();
+    ASSERT_EQ(result.size(), threads * perThread + threads * (perThread / 100) * 10);
+
+    std::vector<int> values;
+    for (const int value : result)
+        if (value >= 0)
+            values.push_back(value);
+
+    std::sort(values.begin(), values.end());
+    ASSERT_EQ(values.size(), threads * perThread);
+    for (int i = 0; i < threads * perThread; ++i)
+        ASSERT_EQ(values[i], i);
+}
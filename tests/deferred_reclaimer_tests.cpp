@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include "cads/deferred_reclaimer.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+// --- HELPERS ---
+struct ReclaimCounted {
+    static inline std::atomic<int> liveInstances = 0;
+
+    int value = 0;
+
+    ReclaimCounted(int v = 0) : value(v) {
+        liveInstances++;
+    }
+
+    ReclaimCounted(const ReclaimCounted& other) : value(other.value) {
+        liveInstances++;
+    }
+
+    ~ReclaimCounted() {
+        liveInstances--;
+    }
+
+    ReclaimCounted& operator=(const ReclaimCounted&) = default;
+};
+
+// Holds the reclaimer thread inside a job until released
+struct ReclaimGate {
+    static inline std::atomic<bool> entered = false;
+    static inline std::atomic<bool> open = false;
+
+    static void reclaim(void*, std::size_t) noexcept
+    {
+        entered.store(true);
+        while (!open.load())
+            std::this_thread::yield();
+    }
+};
+
+// --- TESTS ---
+// DeferredReclaimerTest
+TEST(DeferredReclaimerTest, VectorReleaseIsDeferred)
+{
+    cads::DeferredReclaimer reclaimer;
+
+    cads::Vector<ReclaimCounted> vec;
+    for (int i = 0; i < 1000; ++i)
+        vec.pushBack(ReclaimCounted{i});
+
+    cads::releaseTo(vec, reclaimer);
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.capacity(), 0);
+
+    // Still usable afterwards
+    vec.pushBack(ReclaimCounted{7});
+    EXPECT_EQ(vec[0].value, 7);
+
+    reclaimer.waitIdle();
+    EXPECT_EQ(ReclaimCounted::liveInstances, 1);
+
+    const auto stats = reclaimer.stats();
+    EXPECT_EQ(stats.deferred, 1);
+    EXPECT_EQ(stats.reclaimed, 1);
+    EXPECT_EQ(stats.pending(), 0);
+}
+
+TEST(DeferredReclaimerTest, ListReleaseIsDeferred)
+{
+    cads::DeferredReclaimer reclaimer;
+
+    {
+        cads::List<ReclaimCounted> list;
+        for (int i = 0; i < 1000; ++i)
+            list.pushBack(ReclaimCounted{i});
+
+        cads::releaseTo(list, reclaimer);
+        EXPECT_TRUE(list.empty());
+        EXPECT_EQ(list.begin(), list.end());
+
+        list.pushFront(ReclaimCounted{1});
+        list.pushBack(ReclaimCounted{2});
+        EXPECT_EQ(list.front().value, 1);
+        EXPECT_EQ(list.back().value, 2);
+
+        // Releasing an empty list queues nothing
+        cads::List<ReclaimCounted> empty;
+        cads::releaseTo(empty, reclaimer);
+    }
+
+    reclaimer.waitIdle();
+    EXPECT_EQ(ReclaimCounted::liveInstances, 0);
+    EXPECT_EQ(reclaimer.stats().deferred, 1);
+}
+
+TEST(DeferredReclaimerTest, TrivialVectorIsFreedInline)
+{
+    cads::DeferredReclaimer reclaimer;
+
+    cads::Vector<int> vec(100000, 3);
+    cads::releaseTo(vec, reclaimer);
+
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(reclaimer.stats().deferred, 0);
+}
+
+TEST(DeferredReclaimerTest, FullQueueReclaimsInline)
+{
+    cads::DeferredReclaimer reclaimer{1};
+
+    ReclaimGate::entered = false;
+    ReclaimGate::open = false;
+
+    // Occupy the worker, then fill the single queue slot
+    reclaimer.defer(nullptr, 0, &ReclaimGate::reclaim);
+    while (!ReclaimGate::entered.load())
+        std::this_thread::yield();
+
+    cads::Vector<std::string> queued(10, "queued");
+    cads::releaseTo(queued, reclaimer);
+
+    cads::List<ReclaimCounted> overflow{1, 2, 3};
+    cads::releaseTo(overflow, reclaimer);
+    EXPECT_EQ(reclaimer.stats().reclaimedInline, 1);
+
+    ReclaimGate::open = true;
+    reclaimer.waitIdle();
+
+    const auto stats = reclaimer.stats();
+    EXPECT_EQ(stats.deferred, 2);
+    EXPECT_EQ(stats.reclaimed, 2);
+    EXPECT_EQ(stats.reclaimedInline, 1);
+}
+
+TEST(DeferredReclaimerTest, DestructorDrainsQueue)
+{
+    {
+        cads::DeferredReclaimer reclaimer;
+        for (int round = 0; round < 50; ++round)
+        {
+            cads::Vector<ReclaimCounted> vec(200, ReclaimCounted{round});
+            cads::releaseTo(vec, reclaimer);
+        }
+    }
+
+    EXPECT_EQ(ReclaimCounted::liveInstances, 0);
+}
+
+TEST(DeferredReclaimerTest, ClearDeferredUsesGlobalReclaimer)
+{
+    cads::Vector<ReclaimCounted> vec(500, ReclaimCounted{1});
+    cads::List<ReclaimCounted> list(500, ReclaimCounted{2});
+
+    cads::clearDeferred(vec);
+    cads::clearDeferred(list);
+    EXPECT_TRUE(vec.empty());
+    EXPECT_TRUE(list.empty());
+
+    // Only the list's sentinel is left
+    cads::DeferredReclaimer::global().waitIdle();
+    EXPECT_EQ(ReclaimCounted::liveInstances, 1);
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "cads/inplace_vector.h"
+#include "cads/stack.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// Layout and triviality are part of the contract
+static_assert(std::is_trivially_copyable_v<cads::InplaceVector<int, 8>>);
+static_assert(!std::is_trivially_copyable_v<cads::InplaceVector<std::string, 8>>);
+static_assert(sizeof(cads::InplaceVector<std::uint8_t, 15>) == 16);
+static_assert(sizeof(cads::InplaceVector<std::uint16_t, 300>) == 602);
+
+// --- TESTS ---
+// InplaceVectorTest
+TEST(InplaceVectorTest, PushBackUpToCapacity)
+{
+    cads::InplaceVector<int, 4> vec;
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.capacity(), 4);
+
+    for (int i = 0; i < 4; ++i)
+        vec.pushBack(i);
+
+    EXPECT_TRUE(vec.full());
+    EXPECT_THROW(vec.pushBack(4), std::length_error);
+    EXPECT_FALSE(vec.tryPushBack(4));
+    EXPECT_EQ(vec.size(), 4);
+
+    vec.popBack();
+    EXPECT_TRUE(vec.tryPushBack(9));
+    EXPECT_EQ(vec.back(), 9);
+    EXPECT_EQ(vec.front(), 0);
+    EXPECT_EQ(vec.at(1), 1);
+    EXPECT_THROW(vec.at(4), std::out_of_range);
+}
+
+TEST(InplaceVectorTest, VectorStyleModifiers)
+{
+    cads::InplaceVector<std::string, 8> vec{"a", "c", "d"};
+
+    vec.insert(vec.begin() + 1, "b");
+    vec.insert(vec.end(), "e");
+    vec.insert(vec.begin(), vec.back());
+    EXPECT_EQ(vec.size(), 6);
+    EXPECT_TRUE(std::equal(vec.begin(), vec.end(), cads::InplaceVector<std::string, 8>{"e", "a", "b", "c", "d", "e"}.begin()));
+
+    vec.erase(vec.begin());
+    vec.erase(vec.begin() + 1, vec.begin() + 3);
+    EXPECT_EQ(vec.size(), 3);
+    EXPECT_EQ(vec[0], "a");
+    EXPECT_EQ(vec[1], "d");
+    EXPECT_EQ(vec[2], "e");
+
+    vec.resize(5, "z");
+    EXPECT_EQ(vec.back(), "z");
+    vec.resize(1);
+    EXPECT_EQ(vec.size(), 1);
+
+    EXPECT_THROW(vec.resize(9), std::length_error);
+    EXPECT_THROW(vec.reserve(9), std::length_error);
+    EXPECT_THROW((cads::InplaceVector<int, 2>{1, 2, 3}), std::length_error);
+
+    EXPECT_EQ(*vec.rbegin(), "a");
+}
+
+TEST(InplaceVectorTest, CopyMoveAndSwap)
+{
+    cads::InplaceVector<std::unique_ptr<int>, 4> owning;
+    owning.emplaceBack(std::make_unique<int>(1));
+    owning.emplaceBack(std::make_unique<int>(2));
+
+    cads::InplaceVector<std::unique_ptr<int>, 4> moved{std::move(owning)};
+    ASSERT_EQ(moved.size(), 2);
+    EXPECT_EQ(*moved[1], 2);
+
+    cads::InplaceVector<std::string, 4> a{"x", "y", "z"};
+    cads::InplaceVector<std::string, 4> b{"1"};
+
+    cads::InplaceVector<std::string, 4> copy{a};
+    EXPECT_EQ(copy[2], "z");
+
+    copy = b;
+    EXPECT_EQ(copy.size(), 1);
+    EXPECT_EQ(copy[0], "1");
+
+    a.swap(b);
+    EXPECT_EQ(a.size(), 1);
+    EXPECT_EQ(b.size(), 3);
+    EXPECT_EQ(b[2], "z");
+
+    cads::InplaceVector<int, 4> trivial{1, 2, 3};
+    cads::InplaceVector<int, 4> trivialCopy;
+    trivialCopy = trivial;
+    EXPECT_EQ(trivialCopy.size(), 3);
+    EXPECT_EQ(trivialCopy[2], 3);
+}
+
+TEST(InplaceVectorTest, AsStackContainer)
+{
+    cads::Stack<int, cads::InplaceVector<int, 16>> stack;
+
+    for (int i = 0; i < 16; ++i)
+        stack.push(i);
+    EXPECT_EQ(stack.size(), 16);
+    EXPECT_EQ(stack.top(), 15);
+
+    EXPECT_THROW(stack.push(16), std::length_error);
+
+    stack.pop();
+    EXPECT_EQ(stack.top(), 14);
+}
@@ -3,6 +3,13 @@
 
 #include "cads/list.h"
 
+#include "cads/vector.h"
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
 // --- HELPERS ---
 struct InstanceCounter {
     static inline int liveInstances = 0;
@@ -194,6 +201,33 @@ TEST(ListModifiersTest, ClearEmpty)
     ASSERT_EQ(list.size(), 0);
 }
 
+TEST(ListModifiersTest, AssignReusesNodes)
+{
+    cads::List list { 1, 2, 3, 4 };
+    const int* firstNode = &list.front();
+
+    list.assign(2, 7);
+    EXPECT_THAT(list, ::testing::ElementsAre(7, 7));
+    EXPECT_EQ(&list.front(), firstNode);
+
+    const int values[] = { 5, 6, 8 };
+    list.assign(std::begin(values), std::end(values));
+    EXPECT_THAT(list, ::testing::ElementsAre(5, 6, 8));
+    EXPECT_EQ(&list.front(), firstNode);
+
+    const cads::List other { 9 };
+    list = other;
+    EXPECT_THAT(list, ::testing::ElementsAre(9));
+    EXPECT_EQ(&list.front(), firstNode);
+
+    list = { 1, 2 };
+    EXPECT_THAT(list, ::testing::ElementsAre(1, 2));
+
+    // From an element of the list itself
+    list.assign(4, list.back());
+    EXPECT_THAT(list, ::testing::ElementsAre(2, 2, 2, 2));
+}
+
 TEST(ListModifiersTest, Swap)
 {
     cads::List list { 1, 2 };
@@ -269,6 +303,23 @@ TEST(ListMemoryTest, CopyAssignmentOperator)
     EXPECT_EQ(InstanceCounter::liveInstances, 0);
 }
 
+TEST(ListMemoryTest, CopyAssignmentIntoLongerList)
+{
+    ASSERT_EQ(InstanceCounter::liveInstances, 0);
+
+    {
+        cads::List<InstanceCounter> list1(4);
+        const cads::List<InstanceCounter> list2(1);
+        ASSERT_EQ(InstanceCounter::liveInstances, 7); // +2 for sentinels
+
+        list1 = list2;
+        EXPECT_EQ(list1.size(), 1);
+        EXPECT_EQ(InstanceCounter::liveInstances, 4);
+    }
+
+    EXPECT_EQ(InstanceCounter::liveInstances, 0);
+}
+
 TEST(ListMemoryTest, MoveConstructor)
 {
     ASSERT_EQ(InstanceCounter::liveInstances, 0);
@@ -411,6 +462,53 @@ TEST_F(ListInsertTest, ReturnsCorrectIterator)
     EXPECT_EQ(returnedIt, checkIt);
 }
 
+TEST_F(ListInsertTest, CountAndRange)
+{
+    list = { 1, 5 };
+
+    auto returnedIt = list.insert(++list.begin(), 2, 3);
+    EXPECT_EQ(*returnedIt, 3);
+    EXPECT_THAT(list, ::testing::ElementsAre(1, 3, 3, 5));
+
+    const int values[] = { 7, 8, 9 };
+    returnedIt = list.insert(list.end(), std::begin(values), std::end(values));
+    EXPECT_EQ(*returnedIt, 7);
+    EXPECT_EQ(list.size(), 7);
+    EXPECT_THAT(list, ::testing::ElementsAre(1, 3, 3, 5, 7, 8, 9));
+
+    // Empty ranges insert nothing and return `pos`
+    EXPECT_EQ(list.insert(list.begin(), 0, 4), list.begin());
+    EXPECT_EQ(list.insert(list.end(), values, values), list.end());
+    EXPECT_EQ(list.size(), 7);
+}
+
+TEST_F(ListInsertTest, FromInputIterators)
+{
+    std::istringstream input{ "4 5 6" };
+    list = { 1 };
+
+    list.insert(list.end(), std::istream_iterator<int>{input}, std::istream_iterator<int>{});
+
+    EXPECT_THAT(list, ::testing::ElementsAre(1, 4, 5, 6));
+}
+
+TEST_F(ListInsertTest, LargeBulkInsertAndCopy)
+{
+    cads::Vector<int> values;
+    for (int i = 0; i < 200000; ++i)
+        values.pushBack(i);
+
+    list.insert(list.end(), values.begin(), values.end());
+    const cads::List<int> copy = list;
+
+    ASSERT_EQ(copy.size(), values.size());
+    EXPECT_TRUE(std::equal(copy.begin(), copy.end(), values.begin()));
+
+    // Erasing most of the nodes still frees every block once the rest go
+    list.erase(++list.begin(), --list.end());
+    EXPECT_THAT(list, ::testing::ElementsAre(0, 199999));
+}
+
 // ListEraseTest
 class ListEraseTest : public ::testing::Test
 {
@@ -568,6 +666,15 @@ TEST_F(ListRemoveTest, NonExistentElementRemove)
     EXPECT_THAT(list, ::testing::ElementsAre( 10, 20, 30, 40, 50 ));
 }
 
+TEST_F(ListRemoveTest, ValueAliasingAnElement)
+{
+    list = { 1, 2, 1, 3, 1 };
+
+    list.remove(list.front());
+
+    EXPECT_EQ(list.size(), 2);
+    EXPECT_THAT(list, ::testing::ElementsAre(2, 3));
+}
 
 // ListReverseTest
 class ListReverseTest : public ::testing::Test
@@ -665,4 +772,155 @@ TEST_F(ListSpliceTest, InsideSelf)
 
     EXPECT_EQ(list1.size(), 6);
     EXPECT_THAT(list1, ::testing::ElementsAre(10, 20, 30, 40, 50, 60));
-}
\ No newline at end of file
+}
+// ListLayoutTest
+TEST(ListLayoutTest, CompactKeepsOrderAndPacksNodes)
+{
+    cads::List<int> list;
+    for (int i = 0; i < 1000; ++i)
+    {
+        // Alternating ends puts list order and allocation order at odds
+        if (i % 2 == 0)
+            list.pushBack(i);
+        else
+            list.pushFront(i);
+    }
+
+    const cads::List<int> before = list;
+    list.compact();
+
+    ASSERT_EQ(list.size(), before.size());
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), before.begin()));
+
+    // Consecutive elements now sit at a constant stride
+    auto it = list.begin();
+    const int* prev = &*it;
+    const std::ptrdiff_t stride = &*++it - prev;
+    EXPECT_GT(stride, 0);
+    for (prev = &*it, ++it; it != list.end(); prev = &*it, ++it)
+        ASSERT_EQ(&*it - prev, stride);
+}
+
+TEST(ListLayoutTest, IncrementalCompactWithBudget)
+{
+    cads::List<int> list;
+    for (int i = 0; i < 100; ++i)
+        list.pushBack(i);
+    for (auto it = list.begin(); it != list.end();)
+    {
+        it = list.erase(it);
+        if (it != list.end())
+            ++it;
+    }
+
+    size_t calls = 0;
+    for (auto it = list.cbegin(); it != list.cend(); ++calls)
+        it = list.compact(it, 8);
+
+    EXPECT_EQ(calls, 7);
+    EXPECT_EQ(list.size(), 50);
+    int expected = 1;
+    for (const int value : list)
+    {
+        ASSERT_EQ(value, expected);
+        expected += 2;
+    }
+
+    // A second pass finds every window already contiguous
+    const int* firstAddress = &list.front();
+    for (auto it = list.cbegin(); it != list.cend();)
+        it = list.compact(it, 8);
+    EXPECT_EQ(&list.front(), firstAddress);
+}
+
+TEST(ListLayoutTest, CompactedNodesOutliveTheirList)
+{
+    ASSERT_EQ(InstanceCounter::liveInstances, 0);
+
+    {
+        cads::List<InstanceCounter> target;
+        {
+            cads::List<InstanceCounter> source(20);
+            source.compact();
+
+            auto last = source.begin();
+            std::advance(last, 5);
+            target.splice(target.end(), source, source.begin(), last);
+
+            source.popBack();
+            source.erase(source.begin());
+        }
+
+        EXPECT_EQ(target.size(), 5);
+        target.compact();
+        target.pushBack(InstanceCounter{});
+    }
+
+    EXPECT_EQ(InstanceCounter::liveInstances, 0);
+}
+
+// ListForEachTest
+TEST(ListForEachTest, VisitsInOrder)
+{
+    cads::List<int> list;
+    for (int i = 0; i < 100; ++i)
+        list.pushBack(i);
+
+    list.forEach([](int& value) { value *= 2; });
+
+    const cads::List<int>& constList = list;
+    int expected = 0;
+    constList.forEach([&expected](const int& value) {
+        EXPECT_EQ(value, expected);
+        expected += 2;
+    });
+    EXPECT_EQ(expected, 200);
+
+    cads::List<int> empty;
+    empty.forEach([](int&) { FAIL(); });
+}
+
+// ListBulkTest
+struct ThrowingCopy {
+    static inline int liveInstances = 0;
+    static inline int copiesUntilThrow = -1;
+
+    int value = 0;
+
+    ThrowingCopy(int v = 0) : value(v) {
+        liveInstances++;
+    }
+
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value) {
+        if (copiesUntilThrow == 0)
+            throw std::runtime_error("copy failed");
+        if (copiesUntilThrow > 0)
+            copiesUntilThrow--;
+        liveInstances++;
+    }
+
+    ~ThrowingCopy() {
+        liveInstances--;
+    }
+};
+
+TEST(ListBulkTest, ThrowingCopyLeavesNothingBehind)
+{
+    {
+        const cads::List<ThrowingCopy> source(100, ThrowingCopy{1});
+        const int baseline = ThrowingCopy::liveInstances;
+
+        ThrowingCopy::copiesUntilThrow = 50;
+        EXPECT_THROW({ const cads::List<ThrowingCopy> copy = source; }, std::runtime_error);
+        EXPECT_EQ(ThrowingCopy::liveInstances, baseline);
+        ThrowingCopy::copiesUntilThrow = -1;
+
+        cads::List<ThrowingCopy> target(3, ThrowingCopy{2});
+        ThrowingCopy::copiesUntilThrow = 10;
+        EXPECT_THROW(target.insert(target.begin(), source.begin(), source.end()), std::runtime_error);
+        EXPECT_EQ(target.size(), 3);
+        ThrowingCopy::copiesUntilThrow = -1;
+    }
+
+    EXPECT_EQ(ThrowingCopy::liveInstances, 0);
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include "cads/mapped_vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <unistd.h>
+
+// --- HELPERS ---
+struct Record
+{
+    std::int32_t id;
+    double value;
+};
+
+// Unique path in the temp directory, removed on destruction
+class TempPath
+{
+public:
+    explicit TempPath(const std::string& name)
+        : m_path{std::filesystem::temp_directory_path() /
+                 ("cads_mapped_" + std::to_string(::getpid()) + "_" + name)}
+    {
+        std::filesystem::remove(m_path);
+    }
+
+    ~TempPath()
+    {
+        std::error_code ignored;
+        std::filesystem::remove(m_path, ignored);
+    }
+
+    const std::filesystem::path& path() const { return m_path; }
+
+private:
+    std::filesystem::path m_path;
+};
+
+// --- TESTS ---
+// MappedVectorTest
+TEST(MappedVectorTest, PushBackPersistsAcrossReopen)
+{
+    const TempPath file{"persist"};
+
+    {
+        cads::MappedVector<Record> vec{file.path()};
+        EXPECT_TRUE(vec.empty());
+
+        for (int i = 0; i < 10000; ++i)
+            vec.pushBack(Record{i, i * 0.5});
+
+        EXPECT_EQ(vec.size(), 10000);
+        EXPECT_GE(vec.capacity(), 10000);
+        vec.flush();
+    }
+
+    // Truncated to the exact size on close
+    EXPECT_EQ(std::filesystem::file_size(file.path()), 10000 * sizeof(Record));
+
+    const cads::MappedVector<Record> reopened{file.path(), cads::MapMode::ReadOnly};
+    ASSERT_EQ(reopened.size(), 10000);
+    EXPECT_EQ(reopened.capacity(), 10000);
+    EXPECT_EQ(reopened.mode(), cads::MapMode::ReadOnly);
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        ASSERT_EQ(reopened[i].id, i);
+        ASSERT_EQ(reopened[i].value, i * 0.5);
+    }
+    EXPECT_EQ(reopened.back().id, 9999);
+    EXPECT_THROW(reopened.at(10000), std::out_of_range);
+}
+
+TEST(MappedVectorTest, ReserveResizeAndShrink)
+{
+    const TempPath file{"resize"};
+    cads::MappedVector<std::uint64_t> vec{file.path()};
+
+    vec.reserve(100);
+    EXPECT_GE(vec.capacity(), 100);
+    EXPECT_EQ(std::filesystem::file_size(file.path()), vec.capacity() * sizeof(std::uint64_t));
+
+    vec.resize(10, 7);
+    std::iota(vec.begin(), vec.begin() + 5, 1);
+    EXPECT_EQ(std::accumulate(vec.begin(), vec.end(), std::uint64_t{0}), 15 + 5 * 7);
+    EXPECT_EQ(*vec.rbegin(), 7);
+
+    vec.resize(3);
+    vec.shrinkToFit();
+    EXPECT_EQ(vec.capacity(), 3);
+    EXPECT_EQ(std::filesystem::file_size(file.path()), 3 * sizeof(std::uint64_t));
+
+    // The pushed value lives in the mapping that pushBack moves
+    vec.pushBack(vec[1]);
+    EXPECT_EQ(vec.size(), 4);
+    EXPECT_EQ(vec.back(), 2);
+
+    vec.popBack();
+    vec.close();
+    EXPECT_FALSE(vec.isOpen());
+    EXPECT_EQ(std::filesystem::file_size(file.path()), 3 * sizeof(std::uint64_t));
+}
+
+TEST(MappedVectorTest, MoveTransfersMapping)
+{
+    const TempPath first{"move_first"};
+    const TempPath second{"move_second"};
+
+    cads::MappedVector<int> a{first.path()};
+    a.pushBack(1);
+    a.pushBack(2);
+
+    cads::MappedVector<int> b{std::move(a)};
+    EXPECT_EQ(b.size(), 2);
+    EXPECT_EQ(b[1], 2);
+
+    cads::MappedVector<int> c{second.path()};
+    c.pushBack(3);
+    c = std::move(b);
+    EXPECT_EQ(c.size(), 2);
+
+    // The replaced vector was closed and truncated
+    EXPECT_EQ(std::filesystem::file_size(second.path()), sizeof(int));
+}
+
+TEST(MappedVectorTest, OpenErrors)
+{
+    const TempPath missing{"missing"};
+    EXPECT_THROW((cads::MappedVector<int>{missing.path(), cads::MapMode::ReadOnly}), std::system_error);
+
+    const TempPath odd{"odd"};
+    {
+        std::ofstream out{odd.path(), std::ios::binary};
+        out << "abcde";
+    }
+    EXPECT_THROW((cads::MappedVector<int>{odd.path()}), std::runtime_error);
+
+    const cads::MappedVector<char> bytes{odd.path(), cads::MapMode::ReadOnly};
+    EXPECT_TRUE(std::equal(bytes.begin(), bytes.end(), "abcde"));
+}
+
+TEST(MappedVectorTest, ReadOnlyRejectsWrites)
+{
+    const TempPath file{"readonly"};
+    {
+        cads::MappedVector<int> vec{file.path()};
+        vec.resize(3, 7);
+    }
+
+    cads::MappedVector<int> vec{file.path(), cads::MapMode::ReadOnly};
+    EXPECT_THROW(vec.reserve(100), std::logic_error);
+    EXPECT_THROW(vec.pushBack(1), std::logic_error);
+    EXPECT_THROW(vec.resize(10), std::logic_error);
+
+    // Spare capacity left by popBack() is still read-only
+    vec.popBack();
+    EXPECT_THROW(vec.pushBack(1), std::logic_error);
+    EXPECT_THROW(vec.resize(3), std::logic_error);
+
+    EXPECT_EQ(vec.size(), 2);
+    EXPECT_EQ(vec.capacity(), 3);
+    EXPECT_EQ(vec[1], 7);
+}
@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+#include "cads/persistent_vector.h"
+
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// --- HELPERS ---
+struct TrackedValue {
+    static inline int liveInstances = 0;
+
+    int value = 0;
+
+    TrackedValue(int v = 0) : value(v) {
+        liveInstances++;
+    }
+
+    TrackedValue(const TrackedValue& other) : value(other.value) {
+        liveInstances++;
+    }
+
+    ~TrackedValue() {
+        liveInstances--;
+    }
+
+    TrackedValue& operator=(const TrackedValue&) = default;
+};
+
+// --- TESTS ---
+// PersistentVectorTest
+TEST(PersistentVectorTest, PushBackKeepsOldVersions)
+{
+    cads::PersistentVector<int> empty;
+    const auto one = empty.pushBack(1);
+    const auto two = one.pushBack(2);
+
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(one.size(), 1);
+    EXPECT_EQ(two.size(), 2);
+    EXPECT_EQ(two[1], 2);
+
+    // Deep enough for three trie levels
+    cads::PersistentVector<int> big;
+    std::vector<cads::PersistentVector<int>> checkpoints;
+    for (int i = 0; i < 40000; ++i)
+    {
+        if (i % 10000 == 0)
+            checkpoints.push_back(big);
+        big = big.pushBack(i);
+    }
+
+    ASSERT_EQ(big.size(), 40000);
+    for (int i = 0; i < 40000; ++i)
+        ASSERT_EQ(big[i], i);
+
+    for (size_t c = 0; c < checkpoints.size(); ++c)
+    {
+        ASSERT_EQ(checkpoints[c].size(), c * 10000);
+        if (c > 0)
+        {
+            EXPECT_EQ(checkpoints[c].back(), static_cast<int>(c * 10000 - 1));
+        }
+    }
+
+    int expected = 0;
+    for (const int value : big)
+        ASSERT_EQ(value, expected++);
+    EXPECT_EQ(expected, 40000);
+    EXPECT_THROW(big.at(40000), std::out_of_range);
+}
+
+TEST(PersistentVectorTest, SetAndPopBackAgainstReference)
+{
+    std::mt19937 rng{7};
+    cads::PersistentVector<int> vec;
+    std::vector<int> reference;
+
+    for (int step = 0; step < 60000; ++step)
+    {
+        const unsigned op = rng() % 10;
+        if (reference.empty() || op < 6)
+        {
+            const int value = static_cast<int>(rng());
+            vec = vec.pushBack(value);
+            reference.push_back(value);
+        }
+        else if (op < 8)
+        {
+            const size_t index = rng() % reference.size();
+            const auto before = vec;
+            vec = vec.set(index, step);
+            ASSERT_EQ(before[index], reference[index]);
+            reference[index] = step;
+        }
+        else
+        {
+            vec = vec.popBack();
+            reference.pop_back();
+        }
+    }
+
+    ASSERT_EQ(vec.size(), reference.size());
+    for (size_t i = 0; i < reference.size(); ++i)
+        ASSERT_EQ(vec[i], reference[i]);
+
+    // Pop all the way down through every level
+    while (!vec.empty())
+    {
+        vec = vec.popBack();
+        reference.pop_back();
+        if (!reference.empty())
+        {
+            ASSERT_EQ(vec.back(), reference.back());
+        }
+    }
+}
+
+TEST(PersistentVectorTest, TransientBatchEdits)
+{
+    const cads::PersistentVector<std::string> base{ "a", "b", "c" };
+
+    auto batch = base.transient();
+    for (int i = 0; i < 2000; ++i)
+        batch.pushBack(std::to_string(i));
+    batch.set(0, "z").set(1500, "mid");
+    batch.popBack();
+
+    const auto edited = std::move(batch).persistent();
+    EXPECT_EQ(edited.size(), 2002);
+    EXPECT_EQ(edited[0], "z");
+    EXPECT_EQ(edited[1500], "mid");
+    EXPECT_EQ(edited.back(), "1998");
+
+    // The source version is untouched
+    EXPECT_EQ(base.size(), 3);
+    EXPECT_EQ(base[0], "a");
+
+    // Editing the result further does not disturb it either
+    auto second = edited.transient();
+    second.set(0, "y").pushBack("x");
+    const auto again = std::move(second).persistent();
+    EXPECT_EQ(edited[0], "z");
+    EXPECT_EQ(again[0], "y");
+
+    const auto flat = again.toVector();
+    EXPECT_EQ(flat.size(), again.size());
+    EXPECT_EQ(flat[2000], again[2000]);
+}
+
+TEST(PersistentVectorTest, VersionsReleaseTheirElements)
+{
+    ASSERT_EQ(TrackedValue::liveInstances, 0);
+
+    {
+        cads::PersistentVector<TrackedValue> vec;
+        for (int i = 0; i < 3000; ++i)
+            vec = vec.pushBack(TrackedValue{i});
+
+        const auto shared = vec.set(5, TrackedValue{-1});
+        const auto shorter = shared.popBack().popBack();
+        EXPECT_EQ(shorter[5].value, -1);
+        EXPECT_EQ(vec[5].value, 5);
+    }
+
+    EXPECT_EQ(TrackedValue::liveInstances, 0);
+}
+
+// AtomicPersistentVectorTest
+TEST(AtomicPersistentVectorTest, ReadersSeeConsistentVersions)
+{
+    cads::AtomicPersistentVector<int> published;
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r)
+    {
+        readers.emplace_back([&published, &done] {
+            size_t lastSize = 0;
+            while (!done.load(std::memory_order_acquire))
+            {
+                const auto snapshot = published.load();
+                ASSERT_GE(snapshot.size(), lastSize);
+                lastSize = snapshot.size();
+                for (size_t i = 0; i < snapshot.size(); i += 97)
+                    ASSERT_EQ(snapshot[i], static_cast<int>(i));
+            }
+        });
+    }
+
+    cads::PersistentVector<int> current;
+    for (int i = 0; i < 5000; ++i)
+    {
+        current = current.pushBack(i);
+        published.store(current);
+    }
+    done.store(true, std::memory_order_release);
+
+    for (auto& reader : readers)
+        reader.join();
+
+    EXPECT_EQ(published.load().size(), 5000);
+}
+
+TEST(AtomicPersistentVectorTest, ConcurrentStoresAndLoads)
+{
+    // Every version is uniform: `n` copies of `n`, so a torn or freed version shows up as a mismatch
+    auto uniform = [](const int n) {
+        cads::PersistentVector<int> version;
+        for (int i = 0; i < n; ++i)
+            version = version.pushBack(n);
+        return version;
+    };
+
+    std::vector<cads::PersistentVector<int>> versions;
+    for (int n = 1; n <= 8; ++n)
+        versions.push_back(uniform(n));
+
+    cads::AtomicPersistentVector<int> published{versions[0]};
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 8; ++r)
+    {
+        readers.emplace_back([&published, &done] {
+            while (!done.load(std::memory_order_acquire))
+            {
+                const auto snapshot = published.load();
+                ASSERT_FALSE(snapshot.empty());
+                const int n = static_cast<int>(snapshot.size());
+                ASSERT_EQ(snapshot[0], n);
+                ASSERT_EQ(snapshot.back(), n);
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 4; ++w)
+    {
+        writers.emplace_back([&published, &versions, w] {
+            for (int i = 0; i < 50000; ++i)
+                published.store(versions[(i + w) % versions.size()]);
+        });
+    }
+
+    for (auto& writer : writers)
+        writer.join();
+    done.store(true, std::memory_order_release);
+    for (auto& reader : readers)
+        reader.join();
+
+    EXPECT_FALSE(published.load().empty());
+}
@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+#include "cads/priority_queue.h"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// --- HELPERS ---
+template <typename Queue>
+std::vector<int> drain(Queue& queue)
+{
+    std::vector<int> result;
+    while (!queue.empty())
+    {
+        result.push_back(queue.top());
+        queue.pop();
+    }
+    return result;
+}
+
+// Moves throw while `failMoves` is set
+struct FlakyPriority {
+    static inline bool failMoves = false;
+
+    int key = 0;
+
+    FlakyPriority(int k = 0) : key(k) {}
+    FlakyPriority(const FlakyPriority&) = default;
+
+    FlakyPriority(FlakyPriority&& other) : key(other.key) {
+        if (failMoves)
+            throw std::runtime_error("move failed");
+    }
+
+    FlakyPriority& operator=(const FlakyPriority&) = default;
+    FlakyPriority& operator=(FlakyPriority&&) = default;
+
+    bool operator<(const FlakyPriority& other) const { return key < other.key; }
+};
+
+// --- TESTS ---
+// PriorityQueueTest
+TEST(PriorityQueueTest, MaxHeapBehaviour)
+{
+    cads::PriorityQueue<int> queue;
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.size(), 0);
+
+    for (int value : { 5, 1, 9, 3, 7, 9, 0 })
+        queue.push(value);
+
+    EXPECT_EQ(queue.size(), 7);
+    EXPECT_EQ(queue.top(), 9);
+    EXPECT_EQ(drain(queue), (std::vector<int>{ 9, 9, 7, 5, 3, 1, 0 }));
+}
+
+TEST(PriorityQueueTest, MinHeapWithGreater)
+{
+    cads::PriorityQueue<int, std::greater<int>> queue;
+
+    for (int value : { 5, 1, 9, 3 })
+        queue.push(value);
+
+    EXPECT_EQ(drain(queue), (std::vector<int>{ 1, 3, 5, 9 }));
+}
+
+TEST(PriorityQueueTest, RandomizedForSeveralArities)
+{
+    std::mt19937 rng{7};
+    std::vector<int> values(1000);
+    for (auto& value : values)
+        value = static_cast<int>(rng() % 500);
+
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end(), std::greater<int>{});
+
+    cads::PriorityQueue<int, std::less<int>, cads::Vector<int>, 2> binary;
+    cads::PriorityQueue<int> quaternary;
+    cads::PriorityQueue<int, std::less<int>, cads::Vector<int>, 8> octonary;
+    for (int value : values)
+    {
+        binary.push(value);
+        quaternary.push(value);
+        octonary.push(value);
+    }
+
+    EXPECT_EQ(drain(binary), expected);
+    EXPECT_EQ(drain(quaternary), expected);
+    EXPECT_EQ(drain(octonary), expected);
+}
+
+TEST(PriorityQueueTest, BuildFrom)
+{
+    cads::Vector<int> values;
+    for (int i = 0; i < 200; ++i)
+        values.pushBack((i * 37) % 101);
+
+    std::vector<int> expected(values.begin(), values.end());
+    std::sort(expected.begin(), expected.end(), std::greater<int>{});
+
+    auto queue = cads::PriorityQueue<int>::buildFrom(std::move(values));
+    EXPECT_EQ(queue.size(), 200);
+    EXPECT_EQ(drain(queue), expected);
+
+    auto empty = cads::PriorityQueue<int>::buildFrom(cads::Vector<int>{});
+    EXPECT_TRUE(empty.empty());
+}
+
+TEST(PriorityQueueTest, EmplaceAndMoveOnlyFriendlyValues)
+{
+    cads::PriorityQueue<std::string> queue;
+
+    queue.emplace(3, 'b');
+    queue.emplace("aaaa");
+    queue.push(std::string{"c"});
+
+    EXPECT_EQ(queue.top(), "c");
+    queue.pop();
+    EXPECT_EQ(queue.top(), "bbb");
+}
+
+// IndexedPriorityQueueTest
+TEST(IndexedPriorityQueueTest, DecreaseKeyAndErase)
+{
+    cads::IndexedPriorityQueue<int, std::greater<int>> queue;
+
+    const auto a = queue.push(50);
+    const auto b = queue.push(40);
+    const auto c = queue.push(30);
+    const auto d = queue.push(20);
+
+    EXPECT_EQ(queue.topHandle(), d);
+
+    queue.decreaseKey(a, 10);
+    EXPECT_EQ(queue.topHandle(), a);
+    EXPECT_EQ(queue.value(a), 10);
+
+    queue.erase(d);
+    EXPECT_FALSE(queue.contains(d));
+    EXPECT_EQ(queue.size(), 3);
+
+    queue.update(a, 45);
+    EXPECT_EQ(queue.topHandle(), c);
+
+    EXPECT_EQ(queue.top(), 30);
+    queue.pop();
+    EXPECT_EQ(queue.top(), 40);
+    EXPECT_EQ(queue.topHandle(), b);
+    queue.pop();
+    EXPECT_EQ(queue.top(), 45);
+    queue.pop();
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(IndexedPriorityQueueTest, DijkstraShortestPaths)
+{
+    // Edges as (from, to, weight)
+    const std::vector<std::tuple<int, int, int>> edges {
+        { 0, 1, 7 }, { 0, 2, 9 }, { 0, 5, 14 }, { 1, 2, 10 }, { 1, 3, 15 },
+        { 2, 3, 11 }, { 2, 5, 2 }, { 3, 4, 6 }, { 4, 5, 9 },
+    };
+    constexpr int nodes = 6;
+
+    using Entry = std::pair<int, int>; // (distance, node)
+    cads::IndexedPriorityQueue<Entry, std::greater<Entry>> queue;
+
+    std::vector<int> distance(nodes, 1 << 30);
+    std::vector<size_t> handles(nodes);
+    distance[0] = 0;
+    for (int node = 0; node < nodes; ++node)
+        handles[node] = queue.push({ distance[node], node });
+
+    while (!queue.empty())
+    {
+        const auto [dist, node] = queue.top();
+        queue.pop();
+
+        for (const auto& [from, to, weight] : edges)
+        {
+            for (auto [u, v] : { std::pair{ from, to }, std::pair{ to, from } })
+            {
+                if (u == node && queue.contains(handles[v]) && dist + weight < distance[v])
+                {
+                    distance[v] = dist + weight;
+                    queue.decreaseKey(handles[v], { distance[v], v });
+                }
+            }
+        }
+    }
+
+    EXPECT_EQ(distance, (std::vector<int>{ 0, 7, 9, 20, 20, 11 }));
+}
+
+TEST(IndexedPriorityQueueTest, RandomizedAgainstSort)
+{
+    std::mt19937 rng{11};
+    cads::IndexedPriorityQueue<int> queue;
+    std::vector<std::pair<size_t, int>> live;
+
+    for (int step = 0; step < 3000; ++step)
+    {
+        const int value = static_cast<int>(rng() % 1000);
+        live.emplace_back(queue.push(value), value);
+
+        if (step % 3 == 0)
+        {
+            const size_t victim = rng() % live.size();
+            queue.update(live[victim].first, live[victim].second = static_cast<int>(rng() % 1000));
+        }
+        if (step % 5 == 0)
+        {
+            const size_t victim = rng() % live.size();
+            queue.erase(live[victim].first);
+            live.erase(live.begin() + static_cast<std::ptrdiff_t>(victim));
+        }
+    }
+
+    std::vector<int> expected;
+    for (const auto& entry : live)
+        expected.push_back(entry.second);
+    std::sort(expected.begin(), expected.end(), std::greater<int>{});
+
+    EXPECT_EQ(drain(queue), expected);
+}
+
+TEST(IndexedPriorityQueueTest, FailedPushKeepsHandles)
+{
+    cads::IndexedPriorityQueue<FlakyPriority> queue;
+
+    const auto first = queue.push(FlakyPriority{1});
+    queue.push(FlakyPriority{2});
+    queue.erase(first);
+
+    // Neither the recycled handle nor a freshly minted one may be lost
+    FlakyPriority::failMoves = true;
+    EXPECT_THROW(queue.push(FlakyPriority{3}), std::runtime_error);
+    EXPECT_EQ(queue.size(), 1);
+    FlakyPriority::failMoves = false;
+
+    EXPECT_EQ(queue.push(FlakyPriority{4}), first);
+
+    FlakyPriority::failMoves = true;
+    EXPECT_THROW(queue.push(FlakyPriority{5}), std::runtime_error);
+    FlakyPriority::failMoves = false;
+
+    const auto minted = queue.push(FlakyPriority{6});
+    EXPECT_EQ(minted, 2);
+    EXPECT_EQ(queue.push(FlakyPriority{7}), 3);
+    EXPECT_EQ(queue.top().key, 7);
+
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.contains(minted));
+}
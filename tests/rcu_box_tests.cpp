@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include "cads/rcu_box.h"
+#include "cads/list.h"
+#include "cads/vector.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// --- HELPERS ---
+struct RcuPayload {
+    static inline std::atomic<int> liveInstances = 0;
+
+    int value = 0;
+
+    RcuPayload(int v = 0) : value(v) {
+        liveInstances++;
+    }
+
+    RcuPayload(const RcuPayload& other) : value(other.value) {
+        liveInstances++;
+    }
+
+    ~RcuPayload() {
+        liveInstances--;
+    }
+
+    RcuPayload& operator=(const RcuPayload&) = default;
+};
+
+// --- TESTS ---
+// RcuBoxTest
+TEST(RcuBoxTest, ReadAndUpdateVector)
+{
+    cads::RcuBox<cads::Vector<int>> box{cads::Vector<int>{1, 2, 3}};
+
+    {
+        const auto guard = box.read();
+        EXPECT_EQ(guard->size(), 3);
+        EXPECT_EQ((*guard)[2], 3);
+    }
+
+    box.update([](cads::Vector<int>& vec) { vec.pushBack(4); });
+    EXPECT_EQ(box.read()->size(), 4);
+
+    box.store(cads::Vector<int>{9});
+    const auto copy = box.snapshot();
+    ASSERT_EQ(copy.size(), 1);
+    EXPECT_EQ(copy[0], 9);
+}
+
+TEST(RcuBoxTest, GuardKeepsOldVersionAlive)
+{
+    cads::RcuBox<cads::List<int>> box{cads::List<int>{1, 2}};
+
+    const auto before = box.read();
+    box.update([](cads::List<int>& list) { list.pushFront(0); });
+
+    {
+        // Nested guard on the same thread sees the new version
+        const auto after = box.read();
+        EXPECT_EQ(after->size(), 3);
+        EXPECT_EQ(after->front(), 0);
+    }
+
+    cads::detail::EpochDomain::global().collect();
+    EXPECT_EQ(before->size(), 2);
+    EXPECT_EQ(before->front(), 1);
+}
+
+TEST(RcuBoxTest, FailedUpdatePublishesNothing)
+{
+    cads::RcuBox<cads::Vector<int>> box{cads::Vector<int>{1}};
+
+    EXPECT_THROW(box.update([](cads::Vector<int>& vec) {
+        vec.pushBack(2);
+        throw std::runtime_error("abort");
+    }), std::runtime_error);
+
+    EXPECT_EQ(box.read()->size(), 1);
+}
+
+TEST(RcuBoxTest, RetiredVersionsAreReclaimed)
+{
+    auto& domain = cads::detail::EpochDomain::global();
+    domain.collect();
+    ASSERT_EQ(domain.pendingCount(), 0);
+
+    {
+        cads::RcuBox<cads::Vector<RcuPayload>> box;
+        {
+            const auto pinned = box.read();
+            for (int i = 0; i < 10; ++i)
+                box.update([i](cads::Vector<RcuPayload>& vec) { vec.pushBack(RcuPayload{i}); });
+
+            // The pinned reader holds back everything retired while it was active
+            domain.collect();
+            EXPECT_GT(domain.pendingCount(), 0);
+            EXPECT_TRUE(pinned->empty());
+        }
+
+        domain.collect();
+        EXPECT_EQ(domain.pendingCount(), 0);
+        EXPECT_EQ(RcuPayload::liveInstances, 10);
+    }
+
+    EXPECT_EQ(RcuPayload::liveInstances, 0);
+}
+
+TEST(RcuBoxTest, ConcurrentReadersSeeConsistentVersions)
+{
+    cads::RcuBox<cads::Vector<int>> box;
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r)
+    {
+        readers.emplace_back([&box, &done] {
+            size_t lastSize = 0;
+            while (!done.load(std::memory_order_acquire))
+            {
+                const auto guard = box.read();
+                ASSERT_GE(guard->size(), lastSize);
+                lastSize = guard->size();
+                for (size_t i = 0; i < guard->size(); i += 31)
+                    ASSERT_EQ((*guard)[i], static_cast<int>(i));
+            }
+        });
+    }
+
+    for (int i = 0; i < 2000; ++i)
+        box.update([i](cads::Vector<int>& vec) { vec.pushBack(i); });
+    done.store(true, std::memory_order_release);
+
+    for (auto& reader : readers)
+        reader.join();
+
+    EXPECT_EQ(box.read()->size(), 2000);
+}
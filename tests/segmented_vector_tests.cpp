@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include "cads/segmented_vector.h"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// --- TESTS ---
+// SegmentIndexTest
+TEST(SegmentIndexTest, LocateMatchesSegmentLayout)
+{
+    using Index = cads::detail::SegmentIndex<4>;
+
+    // Segments: [0, 4) [4, 12) [12, 28) [28, 60)
+    EXPECT_EQ(Index::locate(0).segment, 0);
+    EXPECT_EQ(Index::locate(3).offset, 3);
+    EXPECT_EQ(Index::locate(4).segment, 1);
+    EXPECT_EQ(Index::locate(4).offset, 0);
+    EXPECT_EQ(Index::locate(11).segment, 1);
+    EXPECT_EQ(Index::locate(12).segment, 2);
+    EXPECT_EQ(Index::locate(59).offset, 31);
+
+    for (size_t i = 0; i < 10000; ++i)
+    {
+        const auto [segment, offset] = Index::locate(i);
+        ASSERT_EQ(Index::startOf(segment) + offset, i);
+        ASSERT_LT(offset, Index::capacityOf(segment));
+    }
+
+    EXPECT_EQ(Index::segmentsFor(0), 0);
+    EXPECT_EQ(Index::segmentsFor(4), 1);
+    EXPECT_EQ(Index::segmentsFor(5), 2);
+}
+
+// SegmentedVectorTest
+TEST(SegmentedVectorTest, PushBackAndIndex)
+{
+    cads::SegmentedVector<int, 4> vec;
+    EXPECT_TRUE(vec.empty());
+
+    for (int i = 0; i < 1000; ++i)
+        vec.pushBack(i);
+
+    EXPECT_EQ(vec.size(), 1000);
+    EXPECT_GE(vec.capacity(), 1000);
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(vec[i], i);
+
+    EXPECT_EQ(vec.front(), 0);
+    EXPECT_EQ(vec.back(), 999);
+    EXPECT_EQ(vec.at(500), 500);
+    EXPECT_THROW(vec.at(1000), std::out_of_range);
+}
+
+TEST(SegmentedVectorTest, GrowthKeepsReferencesStable)
+{
+    cads::SegmentedVector<std::string, 2> vec;
+    vec.pushBack("first");
+
+    const std::string* first = &vec.front();
+    auto it = vec.begin();
+
+    for (int i = 0; i < 5000; ++i)
+        vec.emplaceBack(20, 'x');
+
+    EXPECT_EQ(first, &vec[0]);
+    EXPECT_EQ(*it, "first");
+
+    // Source argument aliasing an element is fine since nothing relocates
+    vec.pushBack(vec.front());
+    EXPECT_EQ(vec.back(), "first");
+}
+
+TEST(SegmentedVectorTest, IteratorsCrossSegments)
+{
+    cads::SegmentedVector<int, 4> vec;
+    for (int i = 0; i < 100; ++i)
+        vec.pushBack(99 - i);
+
+    EXPECT_EQ(std::distance(vec.begin(), vec.end()), 100);
+    EXPECT_EQ(std::accumulate(vec.begin(), vec.end(), 0), 4950);
+
+    std::sort(vec.begin(), vec.end());
+    EXPECT_TRUE(std::is_sorted(vec.cbegin(), vec.cend()));
+    EXPECT_EQ(vec.begin()[37], 37);
+    EXPECT_EQ(*(vec.end() - 1), 99);
+    EXPECT_EQ(*vec.rbegin(), 99);
+
+    std::vector<int> reversed(vec.rbegin(), vec.rend());
+    EXPECT_EQ(reversed.front(), 99);
+    EXPECT_EQ(reversed.back(), 0);
+}
+
+TEST(SegmentedVectorTest, ForEachSegmentVisitsContiguousRuns)
+{
+    cads::SegmentedVector<int, 4> vec;
+    for (int i = 0; i < 20; ++i)
+        vec.pushBack(i);
+
+    std::vector<size_t> lengths;
+    int expected = 0;
+    vec.forEachSegment([&](std::span<int> segment) {
+        lengths.push_back(segment.size());
+        for (const int value : segment)
+            EXPECT_EQ(value, expected++);
+    });
+
+    EXPECT_EQ(lengths, (std::vector<size_t>{ 4, 8, 8 }));
+}
+
+TEST(SegmentedVectorTest, ShrinkFreesUnusedSegments)
+{
+    cads::SegmentedVector<std::unique_ptr<int>, 4> vec;
+    for (int i = 0; i < 60; ++i)
+        vec.pushBack(std::make_unique<int>(i));
+    EXPECT_EQ(vec.segmentCount(), 4);
+
+    while (vec.size() > 5)
+        vec.popBack();
+
+    vec.shrink();
+    EXPECT_EQ(vec.segmentCount(), 2);
+    EXPECT_EQ(vec.capacity(), 12);
+    EXPECT_EQ(*vec.back(), 4);
+
+    vec.clear();
+    EXPECT_EQ(vec.segmentCount(), 2);
+    vec.shrink();
+    EXPECT_EQ(vec.segmentCount(), 0);
+    EXPECT_EQ(vec.capacity(), 0);
+
+    vec.pushBack(std::make_unique<int>(7));
+    EXPECT_EQ(*vec.front(), 7);
+}
+
+TEST(SegmentedVectorTest, CopyAndMove)
+{
+    cads::SegmentedVector<std::string> source{"a", "b", "c"};
+    for (int i = 0; i < 50; ++i)
+        source.pushBack(std::to_string(i));
+
+    cads::SegmentedVector<std::string> copy{source};
+    EXPECT_TRUE(std::equal(copy.begin(), copy.end(), source.begin(), source.end()));
+
+    cads::SegmentedVector<std::string> moved{std::move(copy)};
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), 53);
+
+    cads::SegmentedVector<std::string> assigned;
+    assigned.pushBack("old");
+    assigned = source;
+    EXPECT_EQ(assigned[2], "c");
+
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.back(), "49");
+    EXPECT_EQ(moved.capacity(), 0);
+}
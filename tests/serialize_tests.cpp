@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+#include "cads/serialize.h"
+#include "cads/list.h"
+#include "cads/mapped_vector.h"
+#include "cads/queue.h"
+#include "cads/vector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <unistd.h>
+
+// --- HELPERS ---
+struct Sample
+{
+    std::uint32_t id;
+    float value;
+
+    bool operator==(const Sample&) const = default;
+};
+
+class SnapshotFile
+{
+public:
+    explicit SnapshotFile(const std::string& name)
+        : m_path{std::filesystem::temp_directory_path() /
+                 ("cads_snapshot_" + std::to_string(::getpid()) + "_" + name)}
+    { }
+
+    ~SnapshotFile()
+    {
+        std::error_code ignored;
+        std::filesystem::remove(m_path, ignored);
+    }
+
+    const std::filesystem::path& path() const { return m_path; }
+
+private:
+    std::filesystem::path m_path;
+};
+
+// Pipe whose ends are closed on destruction
+struct Pipe
+{
+    cads::detail::FileDescriptor readEnd;
+    cads::detail::FileDescriptor writeEnd;
+
+    Pipe()
+    {
+        int fds[2];
+        if (::pipe(fds) != 0)
+            cads::detail::throwErrno("pipe");
+        readEnd.reset(fds[0]);
+        writeEnd.reset(fds[1]);
+    }
+};
+
+// --- TESTS ---
+// SerializeTest
+TEST(SerializeTest, VectorRoundTripThroughFile)
+{
+    const SnapshotFile file{"vector"};
+
+    cads::Vector<Sample> samples;
+    for (std::uint32_t i = 0; i < 1000; ++i)
+        samples.pushBack(Sample{i, i * 0.25f});
+
+    cads::serialize(file.path(), samples);
+    EXPECT_EQ(std::filesystem::file_size(file.path()), sizeof(cads::SnapshotHeader) + 1000 * sizeof(Sample));
+
+    const auto loaded = cads::deserialize<cads::Vector<Sample>>(file.path());
+    ASSERT_EQ(loaded.size(), samples.size());
+    EXPECT_TRUE(std::equal(loaded.begin(), loaded.end(), samples.begin()));
+
+    cads::serialize(file.path(), cads::Vector<Sample>{});
+    EXPECT_TRUE(cads::deserialize<cads::Vector<Sample>>(file.path()).empty());
+}
+
+TEST(SerializeTest, ListAndQueueStreamThroughPipe)
+{
+    // More elements than fit in one writev() batch
+    cads::List<int> list;
+    for (int i = 0; i < 3000; ++i)
+        list.pushBack(i);
+
+    Pipe pipe;
+    cads::serialize(pipe.writeEnd.get(), list);
+    const auto asVector = cads::deserialize<cads::Vector<int>>(pipe.readEnd.get());
+    ASSERT_EQ(asVector.size(), 3000);
+    EXPECT_TRUE(std::equal(asVector.begin(), asVector.end(), list.begin()));
+
+    cads::Queue<int> queue;
+    queue.push(7);
+    queue.push(8);
+    queue.push(9);
+    cads::serialize(pipe.writeEnd.get(), queue);
+    auto asQueue = cads::deserialize<cads::Queue<int>>(pipe.readEnd.get());
+    ASSERT_EQ(asQueue.size(), 3);
+    EXPECT_EQ(asQueue.front(), 7);
+    EXPECT_EQ(asQueue.back(), 9);
+
+    cads::serialize(pipe.writeEnd.get(), asVector);
+    const auto asList = cads::deserialize<cads::List<int>>(pipe.readEnd.get());
+    EXPECT_EQ(asList.size(), 3000);
+    EXPECT_EQ(asList.back(), 2999);
+}
+
+TEST(SerializeTest, ViewOverMappedFile)
+{
+    const SnapshotFile file{"view"};
+
+    cads::Vector<Sample> samples;
+    for (std::uint32_t i = 0; i < 5000; ++i)
+        samples.pushBack(Sample{i, -static_cast<float>(i)});
+    cads::serialize(file.path(), samples);
+
+    const cads::MappedVector<std::byte> mapping{file.path(), cads::MapMode::ReadOnly};
+    const cads::View<Sample> view{std::span<const std::byte>(mapping.data(), mapping.size())};
+
+    ASSERT_EQ(view.size(), 5000);
+    EXPECT_EQ(view[4321], (Sample{4321, -4321.0f}));
+    EXPECT_EQ(view.span().back().id, 4999);
+    EXPECT_THROW(view.at(5000), std::out_of_range);
+    EXPECT_TRUE(view.verifyChecksum());
+    EXPECT_EQ(reinterpret_cast<const std::byte*>(view.data()), mapping.data() + sizeof(cads::SnapshotHeader));
+}
+
+TEST(SerializeTest, RejectsCorruptOrMismatchedSnapshots)
+{
+    const SnapshotFile file{"corrupt"};
+    cads::serialize(file.path(), cads::Vector<std::uint32_t>{ 1, 2, 3, 4 });
+
+    cads::Vector<std::byte> bytes;
+    {
+        const cads::MappedVector<std::byte> mapping{file.path(), cads::MapMode::ReadOnly};
+        bytes.assign(mapping.begin(), mapping.end());
+    }
+
+    EXPECT_THROW(cads::View<std::uint64_t>{std::span<const std::byte>(bytes.data(), bytes.size())}, std::runtime_error);
+    EXPECT_THROW(cads::View<std::uint32_t>{std::span<const std::byte>(bytes.data(), bytes.size() - 1)}, std::runtime_error);
+
+    bytes[sizeof(cads::SnapshotHeader) + 5] ^= std::byte{0x10};
+    const cads::View<std::uint32_t> view{std::span<const std::byte>(bytes.data(), bytes.size())};
+    EXPECT_FALSE(view.verifyChecksum());
+
+    Pipe pipe;
+    ASSERT_EQ(::write(pipe.writeEnd.get(), bytes.data(), bytes.size()), static_cast<ssize_t>(bytes.size()));
+    EXPECT_THROW(cads::deserialize<cads::Vector<std::uint32_t>>(pipe.readEnd.get()), std::runtime_error);
+
+    bytes[0] = std::byte{'X'};
+    EXPECT_THROW(cads::View<std::uint32_t>{std::span<const std::byte>(bytes.data(), bytes.size())}, std::runtime_error);
+}
+
+TEST(SerializeTest, RejectsOversizedCount)
+{
+    const SnapshotFile file{"oversized"};
+    cads::serialize(file.path(), cads::Vector<std::uint32_t>{ 1, 2, 3, 4 });
+
+    cads::Vector<std::byte> bytes;
+    {
+        const cads::MappedVector<std::byte> mapping{file.path(), cads::MapMode::ReadOnly};
+        bytes.assign(mapping.begin(), mapping.end());
+    }
+
+    const auto setCount = [&bytes](const std::uint64_t count) {
+        std::memcpy(bytes.data() + offsetof(cads::SnapshotHeader, count), &count, sizeof(count));
+    };
+
+    // count * sizeof overflows size_t: rejected even where the length is unknown
+    setCount(std::numeric_limits<std::uint64_t>::max() / 2);
+    Pipe pipe;
+    ASSERT_EQ(::write(pipe.writeEnd.get(), bytes.data(), bytes.size()), static_cast<ssize_t>(bytes.size()));
+    EXPECT_THROW(cads::deserialize<cads::Vector<std::uint32_t>>(pipe.readEnd.get()), std::runtime_error);
+
+    // Representable but far more than the file holds: rejected before allocating
+    setCount(std::uint64_t{1} << 40);
+    {
+        cads::MappedVector<std::byte> rewrite{file.path(), cads::MapMode::ReadWrite};
+        std::memcpy(rewrite.data(), bytes.data(), bytes.size());
+    }
+    EXPECT_THROW(cads::deserialize<cads::Vector<std::uint32_t>>(file.path()), std::runtime_error);
+    EXPECT_THROW(cads::deserialize<cads::List<std::uint32_t>>(file.path()), std::runtime_error);
+}
+
+TEST(SerializeTest, ChecksumIgnoresChunking)
+{
+    unsigned char data[37];
+    for (unsigned char i = 0; i < sizeof(data); ++i)
+        data[i] = static_cast<unsigned char>(i * 7);
+
+    cads::detail::SnapshotChecksum whole;
+    whole.update(data, sizeof(data));
+
+    cads::detail::SnapshotChecksum pieces;
+    pieces.update(data, 3);
+    pieces.update(data + 3, 11);
+    pieces.update(data + 14, 23);
+
+    EXPECT_EQ(whole.value(), pieces.value());
+
+    cads::detail::SnapshotChecksum shorter;
+    shorter.update(data, sizeof(data) - 1);
+    EXPECT_NE(whole.value(), shorter.value());
+}
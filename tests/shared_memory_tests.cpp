@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "cads/offset_ptr.h"
+#include "cads/shared_memory.h"
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <system_error>
+
+#include <unistd.h>
+
+// --- HELPERS ---
+inline std::string segmentName(const char* name)
+{
+    return "/cads_test_" + std::to_string(::getpid()) + "_" + name;
+}
+
+struct Node
+{
+    int value;
+    cads::OffsetPtr<Node> next;
+};
+
+// --- TESTS ---
+// SharedMemoryTest
+TEST(SharedMemoryTest, CreateOpenAndRemove)
+{
+    const std::string name = segmentName("segment");
+    cads::SharedMemory created = cads::SharedMemory::create(name, 4096);
+    EXPECT_EQ(created.size(), 4096);
+    EXPECT_THROW(cads::SharedMemory::create(name, 4096), std::system_error);
+
+    std::memcpy(created.data(), "hello", 6);
+
+    // A second mapping of the same segment sees the same bytes at a different address
+    const cads::SharedMemory opened = cads::SharedMemory::open(name);
+    EXPECT_NE(opened.data(), created.data());
+    EXPECT_EQ(opened.size(), 4096);
+    EXPECT_STREQ(static_cast<const char*>(opened.data()), "hello");
+
+    EXPECT_TRUE(cads::SharedMemory::remove(name));
+    EXPECT_FALSE(cads::SharedMemory::remove(name));
+    EXPECT_THROW(cads::SharedMemory::open(name), std::system_error);
+
+    // Still mapped after the name is gone
+    EXPECT_STREQ(static_cast<const char*>(created.data()), "hello");
+}
+
+// OffsetPtrTest
+TEST(OffsetPtrTest, FollowsCopiesAndNull)
+{
+    Node nodes[2]{ {1, nullptr}, {2, nullptr} };
+    nodes[0].next = &nodes[1];
+
+    EXPECT_EQ(nodes[0].next->value, 2);
+    EXPECT_FALSE(nodes[1].next);
+
+    // A copy elsewhere still points at the same target
+    const cads::OffsetPtr<Node> copy = nodes[0].next;
+    EXPECT_EQ(copy.get(), &nodes[1]);
+    EXPECT_EQ(copy, nodes[0].next);
+
+    cads::OffsetPtr<Node> self;
+    self = &nodes[0];
+    EXPECT_EQ((*self).value, 1);
+}
+
+// SharedArenaTest
+TEST(SharedArenaTest, StructuresSurviveRemapping)
+{
+    const std::string name = segmentName("arena");
+    const cads::SharedMemory first = cads::SharedMemory::create(name, 1 << 16);
+    cads::SharedMemory::remove(name);
+
+    cads::SharedArena& arena = cads::SharedArena::create(first);
+
+    Node* head = nullptr;
+    for (int i = 0; i < 10; ++i)
+        head = arena.construct<Node>(Node{i, head});
+    arena.setRoot(head);
+
+    // Copy the bytes somewhere else entirely: offsets, unlike pointers, still resolve
+    void* elsewhere = ::operator new(first.size(), std::align_val_t{cads::SharedArena::MaxAlignment});
+    std::memcpy(elsewhere, first.data(), first.size());
+
+    const cads::SharedArena& copy = cads::SharedArena::attach(elsewhere);
+    int expected = 9;
+    for (const Node* node = copy.root<Node>(); node != nullptr; node = node->next.get(), --expected)
+    {
+        EXPECT_GE(reinterpret_cast<const char*>(node), static_cast<const char*>(elsewhere));
+        EXPECT_EQ(node->value, expected);
+    }
+    EXPECT_EQ(expected, -1);
+
+    ::operator delete(elsewhere, std::align_val_t{cads::SharedArena::MaxAlignment});
+}
+
+TEST(SharedArenaTest, RecyclesBlocksAndReportsExhaustion)
+{
+    alignas(cads::SharedArena::MaxAlignment) static unsigned char region[1 << 14];
+    cads::SharedArena& arena = cads::SharedArena::create(region, sizeof(region));
+
+    void* a = arena.allocate(100);
+    const std::size_t unused = arena.unused();
+    arena.deallocate(a);
+
+    // Same size class: served from the free list, not the untouched tail
+    void* b = arena.allocate(90);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(arena.unused(), unused);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % cads::SharedArena::MaxAlignment, 0);
+
+    EXPECT_THROW(arena.allocate(1 << 14), std::bad_alloc);
+    EXPECT_THROW(cads::SharedArena::attach(region + 64), std::runtime_error);
+}
+
+TEST(SharedArenaTest, CloseDetachesArena)
+{
+    alignas(cads::SharedArena::MaxAlignment) static unsigned char region[1 << 12];
+    cads::SharedArena& arena = cads::SharedArena::create(region, sizeof(region));
+    EXPECT_EQ(&cads::SharedArena::attach(region), &arena);
+
+    arena.close();
+    EXPECT_THROW(cads::SharedArena::attach(region), std::runtime_error);
+}
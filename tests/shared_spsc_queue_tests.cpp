@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "cads/shared_memory.h"
+#include "cads/shared_spsc_queue.h"
+
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+// --- TESTS ---
+// SharedSpscQueueTest
+TEST(SharedSpscQueueTest, FifoAndBounded)
+{
+    cads::SharedSpscQueue<int, 4> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryPop().has_value());
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(queue.tryPush(i));
+    EXPECT_FALSE(queue.tryPush(4));
+    EXPECT_EQ(queue.size(), 4);
+
+    EXPECT_EQ(queue.tryPop(), 0);
+    EXPECT_TRUE(queue.tryPush(4));
+
+    for (int i = 1; i <= 4; ++i)
+        EXPECT_EQ(queue.tryPop(), i);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(SharedSpscQueueTest, ProducerAndConsumerThreads)
+{
+    constexpr std::uint64_t Count = 200000;
+    auto* queue = new cads::SharedSpscQueue<std::uint64_t, 256>;
+
+    std::thread producer([queue] {
+        for (std::uint64_t i = 0; i < Count; ++i)
+            while (!queue->tryPush(i))
+                std::this_thread::yield();
+    });
+
+    std::uint64_t expected = 0;
+    while (expected < Count)
+    {
+        if (const auto value = queue->tryPop())
+            ASSERT_EQ(*value, expected++);
+        else
+            std::this_thread::yield();
+    }
+
+    producer.join();
+    delete queue;
+}
+
+TEST(SharedSpscQueueTest, AcrossProcesses)
+{
+    using Queue = cads::SharedSpscQueue<std::uint64_t, 64>;
+    constexpr std::uint64_t Count = 10000;
+
+    const std::string name = "/cads_test_" + std::to_string(::getpid()) + "_spsc";
+    const cads::SharedMemory memory = cads::SharedMemory::create(name, 1 << 16);
+    cads::SharedArena& arena = cads::SharedArena::create(memory);
+    arena.setRoot(arena.construct<Queue>());
+
+    const pid_t child = ::fork();
+    ASSERT_NE(child, -1);
+    if (child == 0)
+    {
+        // Producer: a fresh mapping, at its own address
+        const cads::SharedMemory mapping = cads::SharedMemory::open(name);
+        Queue* queue = cads::SharedArena::attach(mapping).root<Queue>();
+        for (std::uint64_t i = 0; i < Count; ++i)
+            while (!queue->tryPush(i * 3))
+                std::this_thread::yield();
+        ::_exit(0);
+    }
+
+    Queue* queue = arena.root<Queue>();
+    std::uint64_t sum = 0;
+    for (std::uint64_t received = 0; received < Count;)
+    {
+        if (const auto value = queue->tryPop())
+        {
+            sum += *value;
+            ++received;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    cads::SharedMemory::remove(name);
+
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    EXPECT_EQ(sum, 3 * Count * (Count - 1) / 2);
+}
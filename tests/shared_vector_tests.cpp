@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "cads/shared_memory.h"
+#include "cads/shared_vector.h"
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+// --- TESTS ---
+// SharedVectorTest
+TEST(SharedVectorTest, GrowsInsideTheArena)
+{
+    alignas(cads::SharedArena::MaxAlignment) static unsigned char region[1 << 16];
+    cads::SharedArena& arena = cads::SharedArena::create(region, sizeof(region));
+
+    auto* vec = arena.construct<cads::SharedVector<int>>(arena);
+    for (int i = 0; i < 1000; ++i)
+        vec->pushBack(i);
+
+    EXPECT_EQ(vec->size(), 1000);
+    EXPECT_GE(vec->capacity(), 1000);
+    EXPECT_EQ(std::accumulate(vec->begin(), vec->end(), 0), 999 * 1000 / 2);
+    EXPECT_GE(reinterpret_cast<unsigned char*>(vec->data()), region);
+    EXPECT_LT(reinterpret_cast<unsigned char*>(vec->data()), region + sizeof(region));
+
+    vec->pushBack((*vec)[10]);
+    EXPECT_EQ(vec->back(), 10);
+    EXPECT_THROW(vec->at(1001), std::out_of_range);
+
+    vec->resize(3, 7);
+    EXPECT_EQ(vec->size(), 3);
+    vec->resize(5, 7);
+    EXPECT_EQ((*vec)[4], 7);
+    EXPECT_EQ(*vec->rbegin(), 7);
+
+    // Destroying it hands every buffer back to the arena
+    arena.destroy(vec);
+    const std::size_t unused = arena.unused();
+    auto* again = arena.construct<cads::SharedVector<int>>(arena);
+    again->reserve(1000);
+    EXPECT_EQ(arena.unused(), unused);
+    arena.destroy(again);
+}
+
+TEST(SharedVectorTest, CapacityFillsArenaBlocks)
+{
+    alignas(cads::SharedArena::MaxAlignment) static unsigned char region[1 << 16];
+    cads::SharedArena& arena = cads::SharedArena::create(region, sizeof(region));
+    auto* vec = arena.construct<cads::SharedVector<int>>(arena);
+
+    // Whatever the block rounding leaves over becomes capacity
+    vec->pushBack(1);
+    EXPECT_EQ(vec->capacity(), cads::SharedArena::usableSize(4 * sizeof(int)) / sizeof(int));
+
+    // A buffer that fits a 4 KiB block together with its header takes just that block
+    std::size_t unused = arena.unused();
+    vec->reserve(cads::SharedArena::usableSize(4000) / sizeof(int));
+    EXPECT_EQ(unused - arena.unused(), 4096);
+
+    // A power-of-two request spills into the next block, all of which is then used
+    unused = arena.unused();
+    vec->reserve(1024);
+    EXPECT_EQ(unused - arena.unused(), 8192);
+    EXPECT_EQ(vec->capacity(), cads::SharedArena::usableSize(1024 * sizeof(int)) / sizeof(int));
+    EXPECT_GT(vec->capacity(), 2000);
+
+    arena.destroy(vec);
+}
+
+TEST(SharedVectorTest, SharedBetweenMappings)
+{
+    const std::string name = "/cads_test_" + std::to_string(::getpid()) + "_vector";
+    const cads::SharedMemory writer = cads::SharedMemory::create(name, 1 << 16);
+    const cads::SharedMemory reader = cads::SharedMemory::open(name);
+    cads::SharedMemory::remove(name);
+
+    cads::SharedArena& arena = cads::SharedArena::create(writer);
+    auto* written = arena.construct<cads::SharedVector<double>>(arena);
+    arena.setRoot(written);
+    for (int i = 0; i < 100; ++i)
+        written->pushBack(i * 1.5);
+
+    // The reader's mapping is at another address and sees the same vector
+    auto* read = cads::SharedArena::attach(reader).root<cads::SharedVector<double>>();
+    ASSERT_NE(static_cast<void*>(read), static_cast<void*>(written));
+    ASSERT_EQ(read->size(), 100);
+    EXPECT_EQ((*read)[99], 99 * 1.5);
+
+    read->pushBack(-1.0);
+    EXPECT_EQ(written->size(), 101);
+    EXPECT_EQ(written->back(), -1.0);
+}
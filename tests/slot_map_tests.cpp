@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "cads/slot_map.h"
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// --- TESTS ---
+// SlotMapTest
+TEST(SlotMapTest, InsertLookupErase)
+{
+    cads::SlotMap<std::string> map;
+    EXPECT_TRUE(map.empty());
+
+    const auto a = map.insert("a");
+    const auto b = map.emplace(3, 'b');
+    const auto c = map.insert(std::string{"c"});
+
+    EXPECT_EQ(map.size(), 3);
+    EXPECT_EQ(map[a], "a");
+    EXPECT_EQ(map.at(b), "bbb");
+    EXPECT_EQ(*map.get(c), "c");
+
+    EXPECT_TRUE(map.erase(a));
+    EXPECT_FALSE(map.erase(a));
+    EXPECT_FALSE(map.contains(a));
+    EXPECT_EQ(map.get(a), nullptr);
+    EXPECT_THROW(map.at(a), std::out_of_range);
+
+    // Survivors keep their handles after the swap-and-pop
+    EXPECT_EQ(map[b], "bbb");
+    EXPECT_EQ(map[c], "c");
+    EXPECT_EQ(map.size(), 2);
+}
+
+TEST(SlotMapTest, ReusedSlotRejectsStaleHandle)
+{
+    cads::SlotMap<int> map;
+    const auto first = map.insert(1);
+    map.erase(first);
+
+    const auto second = map.insert(2);
+    EXPECT_EQ(second.index, first.index);
+    EXPECT_NE(second.generation, first.generation);
+
+    EXPECT_FALSE(map.contains(first));
+    EXPECT_EQ(map[second], 2);
+
+    EXPECT_FALSE(map.contains(cads::SlotMap<int>::Handle{}));
+}
+
+TEST(SlotMapTest, DenseIterationAndHandleAt)
+{
+    cads::SlotMap<int> map;
+    std::vector<cads::SlotMap<int>::Handle> handles;
+    for (int i = 0; i < 10; ++i)
+        handles.push_back(map.insert(i));
+
+    for (int i = 0; i < 10; i += 2)
+        map.erase(handles[i]);
+
+    std::vector<int> values(map.begin(), map.end());
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(values, (std::vector<int>{ 1, 3, 5, 7, 9 }));
+
+    for (size_t i = 0; i < map.size(); ++i)
+        EXPECT_EQ(map[map.handleAt(i)], map.data()[i]);
+}
+
+TEST(SlotMapTest, ClearInvalidatesHandles)
+{
+    cads::SlotMap<std::string> map;
+    const auto a = map.insert("a");
+    const auto b = map.insert("b");
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(a));
+    EXPECT_FALSE(map.contains(b));
+
+    const auto c = map.insert("c");
+    EXPECT_EQ(map[c], "c");
+    EXPECT_EQ(map.size(), 1);
+}
+
+TEST(SlotMapTest, RandomisedAgainstReference)
+{
+    std::mt19937 rng{42};
+    cads::SlotMap<int> map;
+    std::vector<std::pair<cads::SlotMap<int>::Handle, int>> live;
+    std::vector<cads::SlotMap<int>::Handle> dead;
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        if (live.empty() || rng() % 3 != 0)
+        {
+            const int value = static_cast<int>(rng());
+            live.emplace_back(map.insert(value), value);
+        }
+        else
+        {
+            const size_t pick = rng() % live.size();
+            ASSERT_TRUE(map.erase(live[pick].first));
+            dead.push_back(live[pick].first);
+            live[pick] = live.back();
+            live.pop_back();
+        }
+    }
+
+    ASSERT_EQ(map.size(), live.size());
+    for (const auto& [handle, value] : live)
+        ASSERT_EQ(map[handle], value);
+    for (const auto& handle : dead)
+        ASSERT_FALSE(map.contains(handle));
+}
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include "cads/soa_vector.h"
+
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+// --- HELPERS ---
+using Records = cads::SoAVector<int, double, std::string>;
+
+Records makeRecords(const int count)
+{
+    Records records;
+    for (int i = 0; i < count; ++i)
+        records.emplaceBack(i, i * 0.5, std::to_string(i));
+    return records;
+}
+
+// Copyable field whose copies can be told to fail; no noexcept move, so growth copies it
+struct FragileField {
+    static inline int liveInstances = 0;
+    static inline int copiesUntilThrow = -1;
+
+    int value = 0;
+
+    FragileField(int v = 0) : value(v) {
+        liveInstances++;
+    }
+
+    FragileField(const FragileField& other) : value(other.value) {
+        if (copiesUntilThrow == 0)
+            throw std::runtime_error("copy failed");
+        if (copiesUntilThrow > 0)
+            copiesUntilThrow--;
+        liveInstances++;
+    }
+
+    ~FragileField() {
+        liveInstances--;
+    }
+};
+
+// --- TESTS ---
+// SoAVectorTest
+TEST(SoAVectorTest, PushBackAndRowAccess)
+{
+    Records records;
+    EXPECT_TRUE(records.empty());
+
+    records.pushBack({1, 1.5, "one"});
+    const std::tuple<int, double, std::string> row{2, 2.5, "two"};
+    records.pushBack(row);
+    records.emplaceBack(3, 3.5, "three");
+
+    EXPECT_EQ(records.size(), 3);
+    EXPECT_EQ(std::get<2>(records[0]), "one");
+    EXPECT_EQ(records.get(1), row);
+    EXPECT_EQ(std::get<0>(records.back()), 3);
+    EXPECT_THROW(records.at(3), std::out_of_range);
+
+    // Rows are proxies: writes go straight into the columns
+    std::get<1>(records[2]) = 9.0;
+    EXPECT_EQ(records.data<1>()[2], 9.0);
+}
+
+TEST(SoAVectorTest, ColumnsAreContiguousAndAligned)
+{
+    Records records = makeRecords(100);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(records.data<0>()) % Records::ColumnAlignment, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(records.data<1>()) % Records::ColumnAlignment, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(records.data<2>()) % Records::ColumnAlignment, 0);
+
+    const auto ids = records.column<0>();
+    EXPECT_EQ(ids.size(), 100);
+    EXPECT_EQ(std::accumulate(ids.begin(), ids.end(), 0), 4950);
+
+    const double* values = records.data<1>();
+    double total = 0;
+    for (size_t i = 0; i < records.size(); ++i)
+        total += values[i];
+    EXPECT_DOUBLE_EQ(total, 2475.0);
+}
+
+TEST(SoAVectorTest, ZipIteration)
+{
+    Records records = makeRecords(10);
+
+    int expected = 0;
+    for (auto [id, value, name] : records)
+    {
+        EXPECT_EQ(id, expected);
+        EXPECT_EQ(name, std::to_string(expected));
+        value = -1.0;
+        ++expected;
+    }
+    EXPECT_EQ(expected, 10);
+    EXPECT_EQ(records.data<1>()[7], -1.0);
+
+    const Records& view = records;
+    auto it = view.begin() + 4;
+    EXPECT_EQ(std::get<0>(*it), 4);
+    EXPECT_EQ(std::get<2>(it[2]), "6");
+    EXPECT_EQ(view.end() - view.begin(), 10);
+}
+
+TEST(SoAVectorTest, GrowthPopAndClear)
+{
+    Records records = makeRecords(1000);
+    EXPECT_GE(records.capacity(), 1000);
+
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(std::get<2>(records[i]), std::to_string(i));
+
+    records.popBack();
+    EXPECT_EQ(records.size(), 999);
+    EXPECT_EQ(std::get<0>(records.back()), 998);
+
+    const size_t capacity = records.capacity();
+    records.clear();
+    EXPECT_TRUE(records.empty());
+    EXPECT_EQ(records.capacity(), capacity);
+}
+
+TEST(SoAVectorTest, CopyAndMove)
+{
+    const Records source = makeRecords(20);
+
+    Records copy{source};
+    EXPECT_EQ(copy.size(), 20);
+    EXPECT_EQ(copy.get(13), source.get(13));
+
+    Records moved{std::move(copy)};
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(std::get<2>(moved[19]), "19");
+
+    Records assigned = makeRecords(3);
+    assigned = source;
+    EXPECT_EQ(assigned.size(), 20);
+
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.get(5), source.get(5));
+}
+
+TEST(SoAVectorTest, EmplaceBackFromOwnRowWhileGrowing)
+{
+    Records records = makeRecords(8);
+    ASSERT_EQ(records.size(), records.capacity());
+
+    const auto& [id, weight, name] = records[3];
+    records.emplaceBack(id, weight, name);
+
+    EXPECT_EQ(records.size(), 9);
+    EXPECT_EQ(records.get(8), records.get(3));
+}
+
+TEST(SoAVectorTest, ThrowingCopyDuringGrowth)
+{
+    {
+        cads::SoAVector<int, FragileField> records;
+        for (int i = 0; i < 8; ++i)
+            records.emplaceBack(i, FragileField{i});
+        ASSERT_EQ(records.size(), records.capacity());
+
+        FragileField::copiesUntilThrow = 4;
+        EXPECT_THROW(records.emplaceBack(8, FragileField{8}), std::runtime_error);
+        FragileField::copiesUntilThrow = 4;
+        EXPECT_THROW(records.reserve(100), std::runtime_error);
+        FragileField::copiesUntilThrow = -1;
+
+        // Strong guarantee: the vector is untouched
+        EXPECT_EQ(records.size(), 8);
+        EXPECT_EQ(records.capacity(), 8);
+        EXPECT_EQ(std::get<1>(records[7]).value, 7);
+        EXPECT_EQ(FragileField::liveInstances, 8);
+    }
+
+    EXPECT_EQ(FragileField::liveInstances, 0);
+}
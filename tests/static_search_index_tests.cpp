@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include "cads/static_search_index.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+// --- HELPERS ---
+template <cads::SearchLayout Layout>
+void expectMatchesLowerBound(const cads::Vector<uint64_t>& sorted, const uint64_t maxProbe)
+{
+    cads::StaticSearchIndex<uint64_t, Layout> index{sorted};
+    EXPECT_EQ(index.size(), sorted.size());
+
+    for (uint64_t probe = 0; probe <= maxProbe; ++probe)
+    {
+        const auto expected = static_cast<size_t>(
+            std::lower_bound(sorted.begin(), sorted.end(), probe) - sorted.begin());
+        const bool found = expected < sorted.size() && sorted[expected] == probe;
+
+        ASSERT_EQ(index.lowerBound(probe), expected) << "probe " << probe;
+        ASSERT_EQ(index.contains(probe), found) << "probe " << probe;
+    }
+}
+
+cads::Vector<uint64_t> makeSorted(const size_t size, const uint64_t maxValue, const unsigned seed)
+{
+    std::mt19937_64 rng{seed};
+    std::uniform_int_distribution<uint64_t> dist{0, maxValue};
+
+    cads::Vector<uint64_t> values;
+    for (size_t i = 0; i < size; ++i)
+        values.pushBack(dist(rng));
+
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+// --- TESTS ---
+// StaticSearchIndexTest
+TEST(StaticSearchIndexTest, Empty)
+{
+    cads::StaticSearchIndex<uint64_t> eytzinger;
+    EXPECT_TRUE(eytzinger.empty());
+    EXPECT_EQ(eytzinger.lowerBound(42), 0);
+    EXPECT_FALSE(eytzinger.contains(42));
+
+    cads::StaticSearchIndex<uint64_t, cads::SearchLayout::BTree> btree{cads::Vector<uint64_t>{}};
+    EXPECT_TRUE(btree.empty());
+    EXPECT_EQ(btree.lowerBound(42), 0);
+    EXPECT_FALSE(btree.contains(42));
+}
+
+TEST(StaticSearchIndexTest, EytzingerMatchesLowerBound)
+{
+    for (size_t size = 1; size <= 70; ++size)
+        expectMatchesLowerBound<cads::SearchLayout::Eytzinger>(makeSorted(size, 3 * size, size), 3 * size + 1);
+
+    expectMatchesLowerBound<cads::SearchLayout::Eytzinger>(makeSorted(5000, 20000, 7), 20001);
+}
+
+TEST(StaticSearchIndexTest, BTreeMatchesLowerBound)
+{
+    for (size_t size = 1; size <= 70; ++size)
+        expectMatchesLowerBound<cads::SearchLayout::BTree>(makeSorted(size, 3 * size, size), 3 * size + 1);
+
+    expectMatchesLowerBound<cads::SearchLayout::BTree>(makeSorted(5000, 20000, 7), 20001);
+}
+
+TEST(StaticSearchIndexTest, DuplicatesMapToFirstOccurrence)
+{
+    cads::Vector<uint64_t> sorted { 1, 3, 3, 3, 3, 7, 7, 9 };
+
+    cads::StaticSearchIndex<uint64_t> eytzinger{sorted};
+    cads::StaticSearchIndex<uint64_t, cads::SearchLayout::BTree> btree{sorted};
+
+    EXPECT_EQ(eytzinger.lowerBound(3), 1);
+    EXPECT_EQ(eytzinger.lowerBound(7), 5);
+    EXPECT_EQ(btree.lowerBound(3), 1);
+    EXPECT_EQ(btree.lowerBound(7), 5);
+}
+
+TEST(StaticSearchIndexTest, BTreeHandlesMaxValueKeys)
+{
+    constexpr uint64_t max = std::numeric_limits<uint64_t>::max();
+    cads::Vector<uint64_t> sorted { 1, 2, max - 1, max };
+
+    cads::StaticSearchIndex<uint64_t, cads::SearchLayout::BTree> index{sorted};
+
+    EXPECT_TRUE(index.contains(max));
+    EXPECT_EQ(index.lowerBound(max), 3);
+    EXPECT_EQ(index.lowerBound(max - 1), 2);
+    EXPECT_FALSE(index.contains(3));
+}
+
+TEST(StaticSearchIndexTest, Rebuild)
+{
+    cads::StaticSearchIndex<uint64_t> index{cads::Vector<uint64_t>{ 10, 20, 30 }};
+    EXPECT_TRUE(index.contains(20));
+
+    index.rebuild(cads::Vector<uint64_t>{ 5, 15 });
+    EXPECT_EQ(index.size(), 2);
+    EXPECT_FALSE(index.contains(20));
+    EXPECT_EQ(index.lowerBound(20), 2);
+    EXPECT_EQ(index.lowerBound(6), 1);
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include "cads/task_scheduler.h"
+
+#include <atomic>
+#include <functional>
+
+// --- TESTS ---
+// TaskSchedulerTest
+TEST(TaskSchedulerTest, RunsExternallySubmittedTasks)
+{
+    cads::TaskScheduler scheduler{4};
+    EXPECT_EQ(scheduler.threadCount(), 4);
+
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 10000; ++i)
+        scheduler.submit([&counter] { counter.fetch_add(1); });
+
+    scheduler.waitIdle();
+    EXPECT_EQ(counter.load(), 10000);
+}
+
+TEST(TaskSchedulerTest, NestedSubmissionsAreStolen)
+{
+    cads::TaskScheduler scheduler{4};
+    std::atomic<int> leaves{0};
+
+    // Binary fan-out from a single root: only stealing spreads the work
+    std::function<void(int)> spawn = [&](const int depth) {
+        if (depth == 0)
+        {
+            leaves.fetch_add(1);
+            return;
+        }
+        scheduler.submit([&spawn, depth] { spawn(depth - 1); });
+        scheduler.submit([&spawn, depth] { spawn(depth - 1); });
+    };
+
+    scheduler.submit([&spawn] { spawn(14); });
+    scheduler.waitIdle();
+
+    EXPECT_EQ(leaves.load(), 1 << 14);
+}
+
+TEST(TaskSchedulerTest, DestructorFinishesQueuedTasks)
+{
+    std::atomic<int> counter{0};
+    {
+        cads::TaskScheduler scheduler{2};
+        for (int i = 0; i < 1000; ++i)
+            scheduler.submit([&counter] { counter.fetch_add(1); });
+    }
+    EXPECT_EQ(counter.load(), 1000);
+}
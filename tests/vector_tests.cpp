@@ -2,6 +2,7 @@
 #include "cads/vector.h"
 
 #include <stdexcept>
+#include <string>
 
 // --- HELPERS ---
 struct InstanceCounter {
@@ -416,6 +417,108 @@ TEST(VectorModifiersTest, EraseElementRange)
     EXPECT_EQ(it, vec.end());
 }
 
+TEST(VectorModifiersTest, SwapErase)
+{
+    cads::Vector vec{ 10, 20, 30, 40 };
+
+    auto it = vec.swapErase(vec.begin() + 1);
+    EXPECT_EQ(vec.size(), 3);
+    EXPECT_EQ(*it, 40);
+    EXPECT_EQ(vec[0], 10);
+    EXPECT_EQ(vec[2], 30);
+
+    it = vec.swapErase(vec.end() - 1);
+    EXPECT_EQ(vec.size(), 2);
+    EXPECT_EQ(it, vec.end());
+}
+
+TEST(VectorModifiersTest, EraseIfAndRemoveAll)
+{
+    cads::Vector<int> vec;
+    for (int i = 0; i < 20; ++i)
+        vec.pushBack(i);
+
+    EXPECT_EQ(vec.eraseIf([](int value) { return value % 3 == 0; }), 7);
+    ASSERT_EQ(vec.size(), 13);
+    EXPECT_EQ(vec[0], 1);
+    EXPECT_EQ(vec[1], 2);
+    EXPECT_EQ(vec[2], 4);
+    EXPECT_EQ(vec[12], 19);
+    EXPECT_EQ(vec.capacity(), 32);
+
+    cads::Vector<std::string> words{ "a", "b", "a", "c", "a" };
+    EXPECT_EQ(words.removeAll(words[0]), 3);
+    ASSERT_EQ(words.size(), 2);
+    EXPECT_EQ(words[0], "b");
+    EXPECT_EQ(words[1], "c");
+
+    EXPECT_EQ(words.removeAll("z"), 0);
+    EXPECT_EQ(words.eraseIf([](const std::string&) { return true; }), 2);
+    EXPECT_TRUE(words.empty());
+}
+
+TEST(VectorModifiersTest, EraseIndices)
+{
+    cads::Vector<std::string> vec{ "0", "1", "2", "3", "4", "5", "6" };
+
+    EXPECT_EQ(vec.eraseIndices(cads::Vector<size_t>{ 0, 2, 3, 6 }), 4);
+    ASSERT_EQ(vec.size(), 3);
+    EXPECT_EQ(vec[0], "1");
+    EXPECT_EQ(vec[1], "4");
+    EXPECT_EQ(vec[2], "5");
+
+    EXPECT_EQ(vec.eraseIndices(cads::Vector<size_t>{}), 0);
+    EXPECT_EQ(vec.size(), 3);
+
+    cads::Vector<int> numbers{ 1, 2, 3, 4 };
+    numbers.eraseIndices(cads::Vector<size_t>{ 1, 2 });
+    ASSERT_EQ(numbers.size(), 2);
+    EXPECT_EQ(numbers[0], 1);
+    EXPECT_EQ(numbers[1], 4);
+}
+
+TEST(VectorModifiersTest, AssignReusesStorage)
+{
+    cads::Vector<std::string> vec{ "a", "b", "c", "d" };
+    vec.reserve(8);
+    const std::string* storage = vec.data();
+
+    vec.assign(2, "x");
+    EXPECT_EQ(vec.size(), 2);
+    EXPECT_EQ(vec[1], "x");
+
+    const cads::Vector<std::string> source{ "p", "q", "r", "s", "t" };
+    vec.assign(source.begin(), source.end());
+    EXPECT_EQ(vec.size(), 5);
+    EXPECT_EQ(vec[4], "t");
+    EXPECT_EQ(vec.data(), storage);
+
+    vec = cads::Vector<std::string>{ "only" };
+    vec = source;
+    EXPECT_EQ(vec.size(), 5);
+    EXPECT_EQ(vec.capacity(), 5);
+
+    vec = { "1", "2" };
+    EXPECT_EQ(vec.size(), 2);
+    EXPECT_EQ(vec[0], "1");
+
+    vec.reserve(8);
+    storage = vec.data();
+    vec = source;
+    EXPECT_EQ(vec.data(), storage);
+    EXPECT_EQ(vec.capacity(), 8);
+
+    // Growing past the capacity reallocates, even from an element of the vector itself
+    vec.assign(20, vec[2]);
+    EXPECT_EQ(vec.size(), 20);
+    EXPECT_EQ(vec[19], "r");
+
+    // Subrange of itself
+    vec.assign(vec.begin() + 18, vec.end());
+    EXPECT_EQ(vec.size(), 2);
+    EXPECT_EQ(vec[0], "r");
+}
+
 TEST(VectorModifiersTest, Swap)
 {
     cads::Vector vec { 1, 2 };
@@ -495,6 +598,27 @@ TEST(VectorMemoryTest, CopyAssignmentOperator)
     EXPECT_EQ(InstanceCounter::liveInstances, 0);
 }
 
+TEST(VectorMemoryTest, CopyAssignmentIntoLargerVector)
+{
+    ASSERT_EQ(InstanceCounter::liveInstances, 0);
+
+    {
+        cads::Vector<InstanceCounter> v1(5);
+        const cads::Vector<InstanceCounter> v2(2);
+        ASSERT_EQ(InstanceCounter::liveInstances, 7);
+
+        v1 = v2;
+        EXPECT_EQ(v1.size(), 2);
+        EXPECT_EQ(v1.capacity(), 5);
+        EXPECT_EQ(InstanceCounter::liveInstances, 4);
+
+        v1.assign(4, InstanceCounter{});
+        EXPECT_EQ(InstanceCounter::liveInstances, 6);
+    }
+
+    EXPECT_EQ(InstanceCounter::liveInstances, 0);
+}
+
 TEST(VectorMemoryTest, MoveConstructor)
 {
     ASSERT_EQ(InstanceCounter::liveInstances, 0);
@@ -562,4 +686,26 @@ TEST(VectorMemoryTest, EraseDestructors)
     }
 
     ASSERT_EQ(InstanceCounter::liveInstances, 0);
-}
\ No newline at end of file
+}
+
+TEST(VectorMemoryTest, CompactionDestructors)
+{
+    ASSERT_EQ(InstanceCounter::liveInstances, 0);
+
+    {
+        cads::Vector<InstanceCounter> vec(10);
+
+        vec.swapErase(vec.begin());
+        EXPECT_EQ(InstanceCounter::liveInstances, 9);
+
+        size_t calls = 0;
+        vec.eraseIf([&calls](const InstanceCounter&) { return calls++ % 2 == 0; });
+        EXPECT_EQ(InstanceCounter::liveInstances, 4);
+
+        vec.eraseIndices(cads::Vector<size_t>{ 0, 3 });
+        EXPECT_EQ(InstanceCounter::liveInstances, 2);
+        EXPECT_EQ(vec.size(), 2);
+    }
+
+    ASSERT_EQ(InstanceCounter::liveInstances, 0);
+}
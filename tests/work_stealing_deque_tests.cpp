@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "cads/work_stealing_deque.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// --- TESTS ---
+// WorkStealingDequeTest
+TEST(WorkStealingDequeTest, OwnerIsLifoThievesAreFifo)
+{
+    cads::WorkStealingDeque<int> deque;
+
+    EXPECT_TRUE(deque.empty());
+    EXPECT_FALSE(deque.pop().has_value());
+    EXPECT_FALSE(deque.steal().has_value());
+
+    for (int i = 0; i < 4; ++i)
+        deque.push(i);
+    EXPECT_EQ(deque.size(), 4);
+
+    EXPECT_EQ(deque.pop(), 3);
+    EXPECT_EQ(deque.steal(), 0);
+    EXPECT_EQ(deque.pop(), 2);
+    EXPECT_EQ(deque.steal(), 1);
+
+    EXPECT_TRUE(deque.empty());
+    EXPECT_FALSE(deque.pop().has_value());
+}
+
+TEST(WorkStealingDequeTest, GrowsPastInitialCapacity)
+{
+    cads::WorkStealingDeque<int> deque{2};
+    EXPECT_EQ(deque.capacity(), 2);
+
+    for (int i = 0; i < 1000; ++i)
+        deque.push(i);
+
+    EXPECT_GE(deque.capacity(), 1000);
+    EXPECT_EQ(deque.size(), 1000);
+
+    for (int i = 0; i < 500; ++i)
+        EXPECT_EQ(deque.steal(), i);
+    for (int i = 999; i >= 500; --i)
+        EXPECT_EQ(deque.pop(), i);
+}
+
+TEST(WorkStealingDequeTest, ConcurrentStealsTakeEveryItemOnce)
+{
+    constexpr int items = 200000;
+    constexpr int thieves = 4;
+
+    cads::WorkStealingDeque<int> deque{4};
+    std::vector<std::atomic<int>> taken(items);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thieves; ++t)
+    {
+        threads.emplace_back([&] {
+            while (!done.load())
+            {
+                if (auto item = deque.steal())
+                    taken[*item].fetch_add(1);
+            }
+            while (auto item = deque.steal())
+                taken[*item].fetch_add(1);
+        });
+    }
+
+    for (int i = 0; i < items; ++i)
+    {
+        deque.push(i);
+        if (i % 3 == 0)
+        {
+            if (auto item = deque.pop())
+                taken[*item].fetch_add(1);
+        }
+    }
+    while (auto item = deque.pop())
+        taken[*item].fetch_add(1);
+
+    done.store(true);
+    for (auto& thread : threads)
+        thread.join();
+
+    for (int i = 0; i < items; ++i)
+        ASSERT_EQ(taken[i].load(), 1) << "item " << i;
+}